@@ -401,6 +401,17 @@ static void arith(void) {
 	}
 	BENCH_END;
 
+	if (fp_prime_get_par_sps(NULL) != NULL) {
+		fp_prime_get_par(k);
+		BENCH_RUN("ep_mul_basic (z)") {
+			BENCH_ADD(ep_mul_basic(p, q, k));
+		} BENCH_END;
+
+		BENCH_RUN("ep_mul_z") {
+			BENCH_ADD(ep_mul_z(p, q));
+		} BENCH_END;
+	}
+
 	for (int i = 0; i < RLC_EP_TABLE; i++) {
 		ep_new(t[i]);
 	}
@@ -575,6 +586,29 @@ static void arith(void) {
 		BENCH_ADD(ep_map(p, msg, 5));
 	} BENCH_END;
 
+	{
+		uint8_t msg[16][32];
+		const uint8_t *msgs[16];
+		size_t lens[16];
+		ep_t h[16];
+		for (int i = 0; i < 16; i++) {
+			ep_null(h[i]);
+			ep_new(h[i]);
+			rand_bytes(msg[i], sizeof(msg[i]));
+			msgs[i] = msg[i];
+			lens[i] = sizeof(msg[i]);
+		}
+		BENCH_FEW("ep_map_dst (16)",
+			for (int j = 0; j < 16; j++) {
+				ep_map_dst(h[j], msgs[j], lens[j], (const uint8_t *)"RELIC", 5);
+			}, 16);
+		BENCH_FEW("ep_map_sim (16)",
+			ep_map_sim(h, msgs, lens, 16, (const uint8_t *)"RELIC", 5), 16);
+		for (int i = 0; i < 16; i++) {
+			ep_free(h[i]);
+		}
+	}
+
 	BENCH_RUN("ep_pck") {
 		ep_rand(p);
 		BENCH_ADD(ep_pck(q, p));
@@ -369,6 +369,17 @@ static void arith2(void) {
 	}
 	BENCH_END;
 
+	if (fp_prime_get_par_sps(NULL) != NULL) {
+		fp_prime_get_par(k);
+		BENCH_RUN("ep2_mul_basic (z)") {
+			BENCH_ADD(ep2_mul_basic(p, q, k));
+		} BENCH_END;
+
+		BENCH_RUN("ep2_mul_z") {
+			BENCH_ADD(ep2_mul_z(p, q));
+		} BENCH_END;
+	}
+
 	for (int i = 0; i < RLC_EPX_TABLE_MAX; i++) {
 		ep2_new(t[i]);
 	}
@@ -33,6 +33,7 @@
 
 #include "relic.h"
 #include "relic_bench.h"
+#include "relic_fp_low.h"
 
 static void memory(void) {
 	fp_t a[BENCH];
@@ -368,6 +369,31 @@ static void arith(void) {
 	BENCH_END;
 #endif
 
+	/* Compare the backend squaring against multiplication by itself. */
+	BENCH_RUN("fp_muln_low (a * a)") {
+		fp_rand(a);
+		BENCH_ADD(fp_muln_low(d, a, a));
+	}
+	BENCH_END;
+
+	BENCH_RUN("fp_sqrn_low") {
+		fp_rand(a);
+		BENCH_ADD(fp_sqrn_low(d, a));
+	}
+	BENCH_END;
+
+	BENCH_RUN("fp_mulm_low (a * a)") {
+		fp_rand(a);
+		BENCH_ADD(fp_mulm_low(c, a, a));
+	}
+	BENCH_END;
+
+	BENCH_RUN("fp_sqrm_low") {
+		fp_rand(a);
+		BENCH_ADD(fp_sqrm_low(c, a));
+	}
+	BENCH_END;
+
 	BENCH_RUN("fp_dbl") {
 		fp_rand(a);
 		BENCH_ADD(fp_dbl(c, a));
@@ -626,6 +652,12 @@ static void arith(void) {
 	BENCH_END;
 #endif
 
+	BENCH_RUN("fp_exp_z") {
+		fp_rand(a);
+		BENCH_ADD(fp_exp_z(c, a));
+	}
+	BENCH_END;
+
 	BENCH_RUN("fp_srt") {
 		fp_rand(a);
 		fp_sqr(a, a);
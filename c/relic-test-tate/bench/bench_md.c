@@ -35,8 +35,14 @@
 #include "relic_bench.h"
 
 static void hash(void) {
-	uint8_t hash[RLC_MD_LEN], buf[256];
-	const uint8_t *dst = (const uint8_t *)"RELIC";
+	uint8_t hash[RLC_MD_LEN], buf[256], out[16 * 128];
+	const uint8_t *dst = (const uint8_t *)"RELIC", *msgs[16];
+	size_t lens[16];
+
+	for (int i = 0; i < 16; i++) {
+		msgs[i] = buf;
+		lens[i] = 64;
+	}
 
 	BENCH_RUN("md_map (256)") {
 		rand_bytes(buf, sizeof(buf));
@@ -47,6 +53,30 @@ static void hash(void) {
 		rand_bytes(buf, sizeof(buf));
 		BENCH_ADD(md_xmd(buf, sizeof(buf), buf, sizeof(buf), dst, 5));
 	} BENCH_END;
+
+	BENCH_RUN("md_map_sh256 (16 x 64)") {
+		rand_bytes(buf, sizeof(buf));
+		BENCH_ADD(for (int i = 0; i < 16; i++) {
+			md_map_sh256(out + 32 * i, buf, 64);
+		});
+	} BENCH_END;
+
+	BENCH_RUN("md_map_sh256_sim (16 x 64)") {
+		rand_bytes(buf, sizeof(buf));
+		BENCH_ADD(md_map_sh256_sim(out, msgs, lens, 16));
+	} BENCH_END;
+
+	BENCH_RUN("md_xmd (16 x 128)") {
+		rand_bytes(buf, sizeof(buf));
+		BENCH_ADD(for (int i = 0; i < 16; i++) {
+			md_xmd(out + 128 * i, 128, buf, 64, dst, 5);
+		});
+	} BENCH_END;
+
+	BENCH_RUN("md_xmd_sim (16 x 128)") {
+		rand_bytes(buf, sizeof(buf));
+		BENCH_ADD(md_xmd_sim(out, 128, msgs, lens, 16, dst, 5));
+	} BENCH_END;
 }
 
 int main(void) {
@@ -52,12 +52,29 @@ static void memory1(void) {
 	(void)a;
 }
 
+/**
+ * Checks one element of an array of G_1 points with the precomputed Tate test
+ * for bench_par().
+ *
+ * @param[in] a				- the array.
+ * @param[in] i				- the index of the element.
+ */
+static void g1_is_valid_one(void *a, int i) {
+	g1_is_valid_tate_ctx(((g1_t *)a)[i]);
+}
+
 static void util1(void) {
 	g1_t p, q;
+	char label[RLC_BENCH_LABEL];
 	uint8_t bin[2 * RLC_PC_BYTES + 1];
-	int l;
-	fp_t tab[FP_PRIME];
-	fp_t f1, f2, f3;
+	int l, *res = RLC_ALLOCA(int, 4096);
+	tate_tab_t tab;
+	fp_t f1, f2, f3, f4;
+	g1_t *t = RLC_ALLOCA(g1_t, 4096);
+	uint8_t *bins = RLC_ALLOCA(uint8_t, 256 * (RLC_PC_BYTES + 1));
+	const uint8_t **in = RLC_ALLOCA(const uint8_t *, 256);
+	size_t *lens = RLC_ALLOCA(size_t, 256);
+	tate_tab_null(tab);
 	g1_null(p);
 	g1_null(q);
 	g1_new(p);
@@ -65,129 +82,247 @@ static void util1(void) {
     fp_null(f1);
     fp_null(f2);
     fp_null(f3);
+    fp_null(f4);
     fp_new(f1);
     fp_new(f2);
     fp_new(f3);
-	BENCH_RUN("g1_is_infty") {
+    fp_new(f4);
+	BENCH_DIST("g1_is_infty") {
 		g1_rand(p);
-		BENCH_ADD(g1_is_infty(p));
+		BENCH_DIST_ADD(g1_is_infty(p));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("g1_set_infty") {
+	BENCH_DIST("g1_set_infty") {
 		g1_rand(p);
-		BENCH_ADD(g1_set_infty(p));
+		BENCH_DIST_ADD(g1_set_infty(p));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("g1_copy") {
+	BENCH_DIST("g1_copy") {
 		g1_rand(p);
 		g1_rand(q);
-		BENCH_ADD(g1_copy(p, q));
+		BENCH_DIST_ADD(g1_copy(p, q));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("g1_cmp") {
+	BENCH_DIST("g1_cmp") {
 		g1_rand(p);
 		g1_dbl(p, p);
 		g1_rand(q);
 		g1_dbl(q, q);
-		BENCH_ADD(g1_cmp(p, q));
-	} BENCH_END;
+		BENCH_DIST_ADD(g1_cmp(p, q));
+	} BENCH_DIST_END;
 
-	BENCH_RUN("g1_cmp (1 norm)") {
+	BENCH_DIST("g1_cmp (1 norm)") {
 		g1_rand(p);
 		g1_dbl(p, p);
 		g1_rand(q);
-		BENCH_ADD(g1_cmp(p, q));
-	} BENCH_END;
+		BENCH_DIST_ADD(g1_cmp(p, q));
+	} BENCH_DIST_END;
 
-	BENCH_RUN("g1_cmp (2 norm)") {
+	BENCH_DIST("g1_cmp (2 norm)") {
 		g1_rand(p);
 		g1_rand(q);
-		BENCH_ADD(g1_cmp(p, q));
-	} BENCH_END;
+		BENCH_DIST_ADD(g1_cmp(p, q));
+	} BENCH_DIST_END;
 
-	BENCH_RUN("g1_rand") {
-		BENCH_ADD(g1_rand(p));
+	BENCH_DIST("g1_rand") {
+		BENCH_DIST_ADD(g1_rand(p));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("g1_is_valid") {
+	BENCH_DIST("g1_is_valid") {
 		g1_rand(p);
-		BENCH_ADD(g1_is_valid(p));
-	} BENCH_END;
+		BENCH_DIST_ADD(g1_is_valid(p));
+	} BENCH_DIST_END;
 
 	l = ep_curve_is_pairf();
 #if l==EP_B12||l==EP_B24||l==EP_B48||l==EP_BW13
-	BENCH_RUN("tate_exp1") {
+	BENCH_DIST("tate_exp1") {
 		g1_rand(p);
 		fp_rand(f2);
 		fp_rand(f3);
-		BENCH_ADD(tate_exp1(f1, f2, f3));
-	} BENCH_END;
+		BENCH_DIST_ADD(tate_exp1(f1, f2, f3));
+	} BENCH_DIST_END;
 
-	BENCH_RUN("tate_exp2") {
+	BENCH_DIST("tate_exp2") {
 		g1_rand(p);
 		fp_rand(f2);
-		BENCH_ADD(tate_exp2(f1, f2));
-	} BENCH_END;
+		BENCH_DIST_ADD(tate_exp2(f1, f2));
+	} BENCH_DIST_END;
+
+
+	BENCH_DIST("tate_sched") {
+		uint8_t op[RLC_FP_BITS + 1];
+		BENCH_DIST_ADD(tate_sched(op));
+	} BENCH_DIST_END;
 
+	BENCH_DIST("g1_is_valid_tate") {
+		g1_tate_gen(q);
+		g1_rand(p);
+		BENCH_DIST_ADD(g1_is_valid_tate(p, q));
+	} BENCH_DIST_END;
 
-	BENCH_RUN("g1_is_valid_tate") {
+	BENCH_DIST("tate_tab_make") {
 		g1_tate_gen(q);
+		BENCH_DIST_ADD(tate_tab_make(tab, q));
+	} BENCH_DIST_END;
+
+	BENCH_DIST("tate_miller_pre") {
+		g1_rand(p);
+		g1_norm(p, p);
+		fp_rand(f1);
+		fp_rand(f2);
+		fp_rand(f3);
+		fp_rand(f4);
+		BENCH_DIST_ADD(tate_miller_pre(tab->tab, f1, f2, f3, f4, q, p, p));
+	} BENCH_DIST_END;
+
+	BENCH_DIST("tate_miller_vec") {
 		g1_rand(p);
-		BENCH_ADD(g1_is_valid_tate(p, q));
-	} BENCH_END;
+		g1_norm(p, p);
+		fp_rand(f1);
+		fp_rand(f2);
+		fp_rand(f3);
+		fp_rand(f4);
+		BENCH_DIST_ADD(tate_miller_vec(tab->tab, f1, f2, f3, f4, q, p, p));
+	} BENCH_DIST_END;
 
-	BENCH_RUN("g1_is_valid_tate_pre") {
+	BENCH_DIST("g1_is_valid_tate_pre") {
 		g1_tate_gen(q);
-		miller_tab(tab, q);
 		g1_rand(p);
-		BENCH_ADD(g1_is_valid_tate_pre(p, q, tab));
-	} BENCH_END;
+		BENCH_DIST_ADD(g1_is_valid_tate_pre(p, q, tab->tab));
+	} BENCH_DIST_END;
+
+	BENCH_DIST("g1_is_valid_tate_ctx") {
+		g1_rand(p);
+		BENCH_DIST_ADD(g1_is_valid_tate_ctx(p));
+	} BENCH_DIST_END;
+
+#ifdef FP_COUNT
+	g1_rand(p);
+	g1_norm(p, p);
+	BENCH_COUNT("tate_miller", tate_miller(f1, f2, f3, f4, q, p, p));
+	BENCH_COUNT("tate_miller_pre",
+		tate_miller_pre(tab->tab, f1, f2, f3, f4, q, p, p));
+	BENCH_COUNT("tate_exp1", tate_exp1(f1, f2, f3));
+	BENCH_COUNT("tate_exp2", tate_exp2(f1, f2));
+	BENCH_COUNT("g1_is_valid_tate_ctx", g1_is_valid_tate_ctx(p));
 #endif
 
-	BENCH_RUN("g1_size_bin (0)") {
+	g1_tate_gen(q);
+	for (int i = 0; i < 4096; i++) {
+		g1_null(t[i]);
+		g1_new(t[i]);
+		g1_rand(t[i]);
+	}
+	BENCH_FEW("g1_is_valid_tate_batch (1)",
+		g1_is_valid_tate_batch(res, t, 1, q), 1);
+	BENCH_FEW("g1_is_valid_tate_batch (16)",
+		g1_is_valid_tate_batch(res, t, 16, q), 16);
+	BENCH_FEW("g1_is_valid_tate_batch (256)",
+		g1_is_valid_tate_batch(res, t, 256, q), 256);
+	BENCH_FEW("g1_is_valid_tate_batch (4096)",
+		g1_is_valid_tate_batch(res, t, 4096, q), 4096);
+
+	for (int j = 1; j <= RLC_MAX(CORES, 1); j++) {
+		bench_reset();
+		snprintf(label, sizeof(label), "g1_is_valid_tate_lot (%d)", j);
+		bench_label(label);
+		bench_before();
+		for (int i = 0; i < BENCH; i++) {
+			g1_is_valid_tate_lot(res, t, 256, j);
+		}
+		bench_after();
+		bench_compute(BENCH * 256);
+		bench_print();
+	}
+	bench_par("g1_is_valid_tate_par", g1_is_valid_one, t, 4096);
+
+	for (int i = 0; i < 256; i++) {
+		l = g1_size_bin(t[i], 1);
+		g1_write_bin(bins + i * l, l, t[i], 1);
+		in[i] = bins + i * l;
+		lens[i] = l;
+	}
+	BENCH_FEW("g1_read_bin_valid_sim (16)",
+		g1_read_bin_valid_sim(t, res, in, lens, 16), 16);
+	BENCH_FEW("g1_read_bin_valid_sim (256)",
+		g1_read_bin_valid_sim(t, res, in, lens, 256), 256);
+	for (int i = 0; i < 4096; i++) {
+		g1_free(t[i]);
+	}
+	tate_tab_free(tab);
+#endif
+
+	BENCH_DIST("g1_size_bin (0)") {
 		g1_rand(p);
-		BENCH_ADD(g1_size_bin(p, 0));
-	} BENCH_END;
+		BENCH_DIST_ADD(g1_size_bin(p, 0));
+	} BENCH_DIST_END;
 
-	BENCH_RUN("g1_size_bin (1)") {
+	BENCH_DIST("g1_size_bin (1)") {
 		g1_rand(p);
-		BENCH_ADD(g1_size_bin(p, 1));
-	} BENCH_END;
+		BENCH_DIST_ADD(g1_size_bin(p, 1));
+	} BENCH_DIST_END;
 
-	BENCH_RUN("g1_write_bin (0)") {
+	BENCH_DIST("g1_write_bin (0)") {
 		g1_rand(p);
 		l = g1_size_bin(p, 0);
-		BENCH_ADD(g1_write_bin(bin, l, p, 0));
-	} BENCH_END;
+		BENCH_DIST_ADD(g1_write_bin(bin, l, p, 0));
+	} BENCH_DIST_END;
 
-	BENCH_RUN("g1_write_bin (1)") {
+	BENCH_DIST("g1_write_bin (1)") {
 		g1_rand(p);
 		l = g1_size_bin(p, 1);
-		BENCH_ADD(g1_write_bin(bin, l, p, 1));
-	} BENCH_END;
+		BENCH_DIST_ADD(g1_write_bin(bin, l, p, 1));
+	} BENCH_DIST_END;
 
-	BENCH_RUN("g1_read_bin (0)") {
+	BENCH_DIST("g1_read_bin (0)") {
 		g1_rand(p);
 		l = g1_size_bin(p, 0);
 		g1_write_bin(bin, l, p, 0);
-		BENCH_ADD(g1_read_bin(p, bin, l));
-	} BENCH_END;
+		BENCH_DIST_ADD(g1_read_bin(p, bin, l));
+	} BENCH_DIST_END;
+
+	BENCH_DIST("g1_read_bin (1)") {
+		g1_rand(p);
+		l = g1_size_bin(p, 1);
+		g1_write_bin(bin, l, p, 1);
+		BENCH_DIST_ADD(g1_read_bin(p, bin, l));
+	} BENCH_DIST_END;
 
-	BENCH_RUN("g1_read_bin (1)") {
+	BENCH_DIST("g1_read_bin + g1_is_valid (1)") {
 		g1_rand(p);
 		l = g1_size_bin(p, 1);
 		g1_write_bin(bin, l, p, 1);
-		BENCH_ADD(g1_read_bin(p, bin, l));
-	} BENCH_END;	
+		BENCH_DIST_ADD((g1_read_bin(p, bin, l), g1_is_valid(p)));
+	} BENCH_DIST_END;
+
+	BENCH_DIST("g1_read_bin_valid (0)") {
+		g1_rand(p);
+		l = g1_size_bin(p, 0);
+		g1_write_bin(bin, l, p, 0);
+		BENCH_DIST_ADD(g1_read_bin_valid(p, bin, l));
+	} BENCH_DIST_END;
+
+	BENCH_DIST("g1_read_bin_valid (1)") {
+		g1_rand(p);
+		l = g1_size_bin(p, 1);
+		g1_write_bin(bin, l, p, 1);
+		BENCH_DIST_ADD(g1_read_bin_valid(p, bin, l));
+	} BENCH_DIST_END;
 	ep_free(p);
 	ep_free(q);
   	fp_free(f1);
     fp_free(f2);
     fp_free(f3);
+    fp_free(f4);
+	RLC_FREE(res);
+	RLC_FREE(t);
+	RLC_FREE(bins);
+	RLC_FREE(in);
+	RLC_FREE(lens);
 }
 
 static void arith1(void) {
@@ -210,108 +345,108 @@ static void arith1(void) {
 
 	pc_get_ord(n);
 
-	BENCH_RUN("g1_add") {
+	BENCH_DIST("g1_add") {
 		g1_rand(p);
 		g1_rand(q);
 		g1_add(p, p, q);
 		g1_rand(q);
 		g1_rand(p);
 		g1_add(q, q, p);
-		BENCH_ADD(g1_add(r, p, q));
+		BENCH_DIST_ADD(g1_add(r, p, q));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("g1_sub") {
+	BENCH_DIST("g1_sub") {
 		g1_rand(p);
 		g1_rand(q);
 		g1_add(p, p, q);
 		g1_rand(q);
 		g1_rand(p);
 		g1_add(q, q, p);
-		BENCH_ADD(g1_sub(r, p, q));
+		BENCH_DIST_ADD(g1_sub(r, p, q));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("g1_dbl") {
+	BENCH_DIST("g1_dbl") {
 		g1_rand(p);
 		g1_rand(q);
 		g1_add(p, p, q);
-		BENCH_ADD(g1_dbl(r, p));
+		BENCH_DIST_ADD(g1_dbl(r, p));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("g1_neg") {
+	BENCH_DIST("g1_neg") {
 		g1_rand(p);
 		g1_rand(q);
 		g1_add(p, p, q);
-		BENCH_ADD(g1_neg(r, p));
+		BENCH_DIST_ADD(g1_neg(r, p));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("g1_mul") {
+	BENCH_DIST("g1_mul") {
 		bn_rand(k, RLC_POS, bn_bits(n));
 		bn_rand_mod(k, n);
 		g1_rand(p);
-		BENCH_ADD(g1_mul(q, p, k));
+		BENCH_DIST_ADD(g1_mul(q, p, k));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("g1_mul_gen") {
+	BENCH_DIST("g1_mul_gen") {
 		bn_rand(k, RLC_POS, bn_bits(n));
 		bn_rand_mod(k, n);
-		BENCH_ADD(g1_mul_gen(q, k));
+		BENCH_DIST_ADD(g1_mul_gen(q, k));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
 	for (int i = 0; i < RLC_G1_TABLE; i++) {
 		g1_new(t[i]);
 	}
 
-	BENCH_RUN("g1_mul_pre") {
-		BENCH_ADD(g1_mul_pre(t, p));
+	BENCH_DIST("g1_mul_pre") {
+		BENCH_DIST_ADD(g1_mul_pre(t, p));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("g1_mul_fix") {
+	BENCH_DIST("g1_mul_fix") {
 		bn_rand(k, RLC_POS, bn_bits(n));
 		bn_rand_mod(k, n);
 		g1_mul_pre(t, p);
-		BENCH_ADD(g1_mul_fix(q, (const g1_t *)t, k));
+		BENCH_DIST_ADD(g1_mul_fix(q, (const g1_t *)t, k));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("g1_mul_sim") {
+	BENCH_DIST("g1_mul_sim") {
 		bn_rand(k, RLC_POS, bn_bits(n));
 		bn_rand_mod(k, n);
 		bn_rand_mod(l, n);
 		g1_rand(p);
 		g1_rand(q);
-		BENCH_ADD(g1_mul_sim(r, p, k, q, l));
+		BENCH_DIST_ADD(g1_mul_sim(r, p, k, q, l));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("g1_mul_sim_gen") {
+	BENCH_DIST("g1_mul_sim_gen") {
 		bn_rand(k, RLC_POS, bn_bits(n));
 		bn_rand_mod(k, n);
 		bn_rand_mod(l, n);
 		g1_rand(q);
-		BENCH_ADD(g1_mul_sim_gen(r, k, q, l));
+		BENCH_DIST_ADD(g1_mul_sim_gen(r, k, q, l));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("g1_mul_dig") {
+	BENCH_DIST("g1_mul_dig") {
 		bn_rand(k, RLC_POS, bn_bits(n));
 		bn_rand_mod(k, n);
 		g1_rand(p);
-		BENCH_ADD(g1_mul_dig(q, p, k->dp[0]));
+		BENCH_DIST_ADD(g1_mul_dig(q, p, k->dp[0]));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("g1_map") {
+	BENCH_DIST("g1_map") {
 		uint8_t msg[5];
 		rand_bytes(msg, 5);
-		BENCH_ADD(g1_map(p, msg, 5));
-	} BENCH_END;
+		BENCH_DIST_ADD(g1_map(p, msg, 5));
+	} BENCH_DIST_END;
 
 	g1_free(p);
 	g1_free(q);
@@ -352,96 +487,96 @@ static void util2(void) {
 	g2_new(p);
 	g2_new(q);
 
-	BENCH_RUN("g2_is_infty") {
+	BENCH_DIST("g2_is_infty") {
 		g2_rand(p);
-		BENCH_ADD(g2_is_infty(p));
+		BENCH_DIST_ADD(g2_is_infty(p));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("g2_set_infty") {
+	BENCH_DIST("g2_set_infty") {
 		g2_rand(p);
-		BENCH_ADD(g2_set_infty(p));
+		BENCH_DIST_ADD(g2_set_infty(p));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("g2_copy") {
+	BENCH_DIST("g2_copy") {
 		g2_rand(p);
 		g2_rand(q);
-		BENCH_ADD(g2_copy(p, q));
+		BENCH_DIST_ADD(g2_copy(p, q));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("g2_cmp") {
+	BENCH_DIST("g2_cmp") {
 		g2_rand(p);
 		g2_dbl(p, p);
 		g2_rand(q);
 		g2_dbl(q, q);
-		BENCH_ADD(g2_cmp(p, q));
-	} BENCH_END;
+		BENCH_DIST_ADD(g2_cmp(p, q));
+	} BENCH_DIST_END;
 
-	BENCH_RUN("g2_cmp (1 norm)") {
+	BENCH_DIST("g2_cmp (1 norm)") {
 		g2_rand(p);
 		g2_dbl(p, p);
 		g2_rand(q);
-		BENCH_ADD(g2_cmp(p, q));
-	} BENCH_END;
+		BENCH_DIST_ADD(g2_cmp(p, q));
+	} BENCH_DIST_END;
 
-	BENCH_RUN("g2_cmp (2 norm)") {
+	BENCH_DIST("g2_cmp (2 norm)") {
 		g2_rand(p);
 		g2_rand(q);
-		BENCH_ADD(g2_cmp(p, q));
-	} BENCH_END;
+		BENCH_DIST_ADD(g2_cmp(p, q));
+	} BENCH_DIST_END;
 
-	BENCH_RUN("g2_rand") {
-		BENCH_ADD(g2_rand(p));
+	BENCH_DIST("g2_rand") {
+		BENCH_DIST_ADD(g2_rand(p));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("g2_is_valid") {
-		BENCH_ADD(g2_is_valid(p));
+	BENCH_DIST("g2_is_valid") {
+		BENCH_DIST_ADD(g2_is_valid(p));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("g2_is_valid_bn") {
-		BENCH_ADD(g2_is_valid_bn(p));
+	BENCH_DIST("g2_is_valid_bn") {
+		BENCH_DIST_ADD(g2_is_valid_bn(p));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("g2_size_bin (0)") {
+	BENCH_DIST("g2_size_bin (0)") {
 		g2_rand(p);
-		BENCH_ADD(g2_size_bin(p, 0));
-	} BENCH_END;
+		BENCH_DIST_ADD(g2_size_bin(p, 0));
+	} BENCH_DIST_END;
 
-	BENCH_RUN("g2_size_bin (1)") {
+	BENCH_DIST("g2_size_bin (1)") {
 		g2_rand(p);
-		BENCH_ADD(g2_size_bin(p, 1));
-	} BENCH_END;
+		BENCH_DIST_ADD(g2_size_bin(p, 1));
+	} BENCH_DIST_END;
 
-	BENCH_RUN("g2_write_bin (0)") {
+	BENCH_DIST("g2_write_bin (0)") {
 		g2_rand(p);
 		l = g2_size_bin(p, 0);
-		BENCH_ADD(g2_write_bin(bin, l, p, 0));
-	} BENCH_END;
+		BENCH_DIST_ADD(g2_write_bin(bin, l, p, 0));
+	} BENCH_DIST_END;
 
-	BENCH_RUN("g2_write_bin (1)") {
+	BENCH_DIST("g2_write_bin (1)") {
 		g2_rand(p);
 		l = g2_size_bin(p, 1);
-		BENCH_ADD(g2_write_bin(bin, l, p, 1));
-	} BENCH_END;
+		BENCH_DIST_ADD(g2_write_bin(bin, l, p, 1));
+	} BENCH_DIST_END;
 
-	BENCH_RUN("g2_read_bin (0)") {
+	BENCH_DIST("g2_read_bin (0)") {
 		g2_rand(p);
 		l = g2_size_bin(p, 0);
 		g2_write_bin(bin, l, p, 0);
-		BENCH_ADD(g2_read_bin(p, bin, l));
-	} BENCH_END;
+		BENCH_DIST_ADD(g2_read_bin(p, bin, l));
+	} BENCH_DIST_END;
 
-	BENCH_RUN("g2_read_bin (1)") {
+	BENCH_DIST("g2_read_bin (1)") {
 		g2_rand(p);
 		l = g2_size_bin(p, 1);
 		g2_write_bin(bin, l, p, 1);
-		BENCH_ADD(g2_read_bin(p, bin, l));
-	} BENCH_END;
+		BENCH_DIST_ADD(g2_read_bin(p, bin, l));
+	} BENCH_DIST_END;
 
 	g2_free(p)
 	g2_free(q);
@@ -467,109 +602,109 @@ static void arith2(void) {
 
 	pc_get_ord(n);
 
-	BENCH_RUN("g2_add") {
+	BENCH_DIST("g2_add") {
 		g2_rand(p);
 		g2_rand(q);
 		g2_add(p, p, q);
 		g2_rand(q);
 		g2_rand(p);
 		g2_add(q, q, p);
-		BENCH_ADD(g2_add(r, p, q));
+		BENCH_DIST_ADD(g2_add(r, p, q));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("g2_sub") {
+	BENCH_DIST("g2_sub") {
 		g2_rand(p);
 		g2_rand(q);
 		g2_add(p, p, q);
 		g2_rand(q);
 		g2_rand(p);
 		g2_add(q, q, p);
-		BENCH_ADD(g2_sub(r, p, q));
+		BENCH_DIST_ADD(g2_sub(r, p, q));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("g2_dbl") {
+	BENCH_DIST("g2_dbl") {
 		g2_rand(p);
 		g2_rand(q);
 		g2_add(p, p, q);
-		BENCH_ADD(g2_dbl(r, p));
+		BENCH_DIST_ADD(g2_dbl(r, p));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("g2_neg") {
+	BENCH_DIST("g2_neg") {
 		g2_rand(p);
 		g2_rand(q);
 		g2_add(p, p, q);
-		BENCH_ADD(g2_neg(r, p));
+		BENCH_DIST_ADD(g2_neg(r, p));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("g2_mul") {
+	BENCH_DIST("g2_mul") {
 		bn_rand(k, RLC_POS, bn_bits(n));
 		bn_rand_mod(k, n);
 		g2_rand(p);
-		BENCH_ADD(g2_mul(q, p, k));
+		BENCH_DIST_ADD(g2_mul(q, p, k));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("g2_mul_gen") {
+	BENCH_DIST("g2_mul_gen") {
 		bn_rand(k, RLC_POS, bn_bits(n));
 		bn_rand_mod(k, n);
-		BENCH_ADD(g2_mul_gen(q, k));
+		BENCH_DIST_ADD(g2_mul_gen(q, k));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
 	for (int i = 0; i < RLC_G1_TABLE; i++) {
 		g2_new(t[i]);
 	}
 
-	BENCH_RUN("g2_mul_pre") {
-		BENCH_ADD(g2_mul_pre(t, p));
+	BENCH_DIST("g2_mul_pre") {
+		BENCH_DIST_ADD(g2_mul_pre(t, p));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("g2_mul_fix") {
+	BENCH_DIST("g2_mul_fix") {
 		bn_rand(k, RLC_POS, bn_bits(n));
 		bn_rand_mod(k, n);
 		g2_mul_pre(t, p);
-		BENCH_ADD(g2_mul_fix(q, t, k));
+		BENCH_DIST_ADD(g2_mul_fix(q, t, k));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("g2_mul_sim") {
+	BENCH_DIST("g2_mul_sim") {
 		bn_rand(k, RLC_POS, bn_bits(n));
 		bn_rand_mod(k, n);
 		bn_rand_mod(l, n);
 		g2_rand(p);
 		g2_rand(q);
-		BENCH_ADD(g2_mul_sim(r, p, k, q, l));
+		BENCH_DIST_ADD(g2_mul_sim(r, p, k, q, l));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("g2_mul_sim_gen") {
+	BENCH_DIST("g2_mul_sim_gen") {
 		bn_rand(k, RLC_POS, bn_bits(n));
 		bn_rand_mod(k, n);
 		bn_rand_mod(l, n);
 		g2_rand(q);
-		BENCH_ADD(g2_mul_sim_gen(r, k, q, l));
+		BENCH_DIST_ADD(g2_mul_sim_gen(r, k, q, l));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("g2_mul_dig") {
+	BENCH_DIST("g2_mul_dig") {
 		bn_rand(k, RLC_POS, bn_bits(n));
 		bn_rand_mod(k, n);
 		g2_rand(p);
-		BENCH_ADD(g2_mul_dig(q, p, k->dp[0]));
+		BENCH_DIST_ADD(g2_mul_dig(q, p, k->dp[0]));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
 #if FP_PRIME != 509
-	BENCH_RUN("g2_map") {
+	BENCH_DIST("g2_map") {
 		uint8_t msg[5];
 		rand_bytes(msg, 5);
-		BENCH_ADD(g2_map(p, msg, 5));
-	} BENCH_END;
+		BENCH_DIST_ADD(g2_map(p, msg, 5));
+	} BENCH_DIST_END;
 #endif
 
 	g2_free(p);
@@ -611,89 +746,89 @@ static void util(void) {
 	gt_new(a);
 	gt_new(b);
 
-	BENCH_RUN("gt_copy") {
+	BENCH_DIST("gt_copy") {
 		gt_rand(a);
-		BENCH_ADD(gt_copy(b, a));
+		BENCH_DIST_ADD(gt_copy(b, a));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("gt_zero") {
+	BENCH_DIST("gt_zero") {
 		gt_rand(a);
-		BENCH_ADD(gt_zero(a));
+		BENCH_DIST_ADD(gt_zero(a));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("gt_set_unity") {
+	BENCH_DIST("gt_set_unity") {
 		gt_rand(a);
-		BENCH_ADD(gt_set_unity(a));
+		BENCH_DIST_ADD(gt_set_unity(a));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("gt_is_unity") {
+	BENCH_DIST("gt_is_unity") {
 		gt_rand(a);
-		BENCH_ADD((void)gt_is_unity(a));
+		BENCH_DIST_ADD((void)gt_is_unity(a));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("gt_rand") {
-		BENCH_ADD(gt_rand(a));
+	BENCH_DIST("gt_rand") {
+		BENCH_DIST_ADD(gt_rand(a));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("gt_cmp") {
+	BENCH_DIST("gt_cmp") {
 		gt_rand(a);
 		gt_rand(b);
-		BENCH_ADD(gt_cmp(b, a));
+		BENCH_DIST_ADD(gt_cmp(b, a));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("gt_size_bin (0)") {
+	BENCH_DIST("gt_size_bin (0)") {
 		gt_rand(a);
-		BENCH_ADD(gt_size_bin(a, 0));
-	} BENCH_END;
+		BENCH_DIST_ADD(gt_size_bin(a, 0));
+	} BENCH_DIST_END;
 
-	BENCH_RUN("gt_write_bin (0)") {
+	BENCH_DIST("gt_write_bin (0)") {
 		gt_rand(a);
 		l = gt_size_bin(a, 0);
-		BENCH_ADD(gt_write_bin(bin, l, a, 0));
-	} BENCH_END;
+		BENCH_DIST_ADD(gt_write_bin(bin, l, a, 0));
+	} BENCH_DIST_END;
 
-	BENCH_RUN("gt_read_bin (0)") {
+	BENCH_DIST("gt_read_bin (0)") {
 		gt_rand(a);
 		l = gt_size_bin(a, 0);
 		gt_write_bin(bin, l, a, 0);
-		BENCH_ADD(gt_read_bin(a, bin, l));
-	} BENCH_END;
+		BENCH_DIST_ADD(gt_read_bin(a, bin, l));
+	} BENCH_DIST_END;
 
 	if (ep_param_embed() == 12) {
-		BENCH_RUN("gt_size_bin (1)") {
+		BENCH_DIST("gt_size_bin (1)") {
 			gt_rand(a);
-			BENCH_ADD(gt_size_bin(a, 1));
-		} BENCH_END;
+			BENCH_DIST_ADD(gt_size_bin(a, 1));
+		} BENCH_DIST_END;
 
-		BENCH_RUN("gt_write_bin (1)") {
+		BENCH_DIST("gt_write_bin (1)") {
 			gt_rand(a);
 			l = gt_size_bin(a, 1);
-			BENCH_ADD(gt_write_bin(bin, l, a, 1));
-		} BENCH_END;
+			BENCH_DIST_ADD(gt_write_bin(bin, l, a, 1));
+		} BENCH_DIST_END;
 
-		BENCH_RUN("gt_read_bin (1)") {
+		BENCH_DIST("gt_read_bin (1)") {
 			gt_rand(a);
 			l = gt_size_bin(a, 1);
 			gt_write_bin(bin, l, a, 1);
-			BENCH_ADD(gt_read_bin(a, bin, l));
-		} BENCH_END;
+			BENCH_DIST_ADD(gt_read_bin(a, bin, l));
+		} BENCH_DIST_END;
 	}
 
-	BENCH_RUN("gt_is_valid") {
+	BENCH_DIST("gt_is_valid") {
 		gt_rand(a);
-		BENCH_ADD(gt_is_valid(a));
-	} BENCH_END;
+		BENCH_DIST_ADD(gt_is_valid(a));
+	} BENCH_DIST_END;
 
-	BENCH_RUN("gt_is_valid_bn") {
+	BENCH_DIST("gt_is_valid_bn") {
 		gt_rand(a);
-		BENCH_ADD(gt_is_valid_bn(a));
-	} BENCH_END;
+		BENCH_DIST_ADD(gt_is_valid_bn(a));
+	} BENCH_DIST_END;
 
 	gt_free(a);
 	gt_free(b);
@@ -710,58 +845,58 @@ static void arith(void) {
 	bn_new(e);
 	bn_new(f);
 
-	BENCH_RUN("gt_mul") {
+	BENCH_DIST("gt_mul") {
 		gt_rand(a);
 		gt_rand(b);
-		BENCH_ADD(gt_mul(c, a, b));
+		BENCH_DIST_ADD(gt_mul(c, a, b));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("gt_sqr") {
+	BENCH_DIST("gt_sqr") {
 		gt_rand(a);
 		gt_rand(b);
-		BENCH_ADD(gt_sqr(c, a));
+		BENCH_DIST_ADD(gt_sqr(c, a));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("gt_inv") {
+	BENCH_DIST("gt_inv") {
 		gt_rand(a);
-		BENCH_ADD(gt_inv(c, a));
+		BENCH_DIST_ADD(gt_inv(c, a));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("gt_exp") {
+	BENCH_DIST("gt_exp") {
 		gt_rand(a);
 		pc_get_ord(d);
 		bn_rand_mod(e, d);
-		BENCH_ADD(gt_exp(c, a, e));
+		BENCH_DIST_ADD(gt_exp(c, a, e));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("gt_exp_gen") {
+	BENCH_DIST("gt_exp_gen") {
 		pc_get_ord(d);
 		bn_rand_mod(e, d);
-		BENCH_ADD(gt_exp_gen(c, e));
+		BENCH_DIST_ADD(gt_exp_gen(c, e));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("gt_exp_sim") {
+	BENCH_DIST("gt_exp_sim") {
 		gt_rand(a);
 		gt_rand(b);
 		gt_get_ord(d);
 		bn_rand_mod(e, d);
 		bn_rand_mod(f, d);
-		BENCH_ADD(gt_exp_sim(c, a, e, b, f));
+		BENCH_DIST_ADD(gt_exp_sim(c, a, e, b, f));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("gt_exp_dig") {
+	BENCH_DIST("gt_exp_dig") {
 		gt_rand(a);
 		pc_get_ord(d);
 		bn_rand(e, RLC_POS, bn_bits(d));
-		BENCH_ADD(gt_exp_dig(c, a, e->dp[0]));
+		BENCH_DIST_ADD(gt_exp_dig(c, a, e->dp[0]));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
 	gt_free(a);
 	gt_free(b);
@@ -785,45 +920,45 @@ static void pairing(void) {
 	}
 	gt_new(r);
 
-	BENCH_RUN("pc_map") {
+	BENCH_DIST("pc_map") {
 		g1_rand(p[0]);
 		g2_rand(q[0]);
-		BENCH_ADD(pc_map(r, p[0], q[0]));
+		BENCH_DIST_ADD(pc_map(r, p[0], q[0]));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("pc_exp") {
+	BENCH_DIST("pc_exp") {
 		gt_rand(r);
-		BENCH_ADD(pc_exp(r, r));
+		BENCH_DIST_ADD(pc_exp(r, r));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("pc_map_sim (2)") {
+	BENCH_DIST("pc_map_sim (2)") {
 		for(i=0; i<2; i++){
 			g1_new(p[i]);
 			g1_new(q[i]);
 		}
-		BENCH_ADD(pc_map_sim(r, p, q, 2));
+		BENCH_DIST_ADD(pc_map_sim(r, p, q, 2));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("pc_map_sim (5)") {
+	BENCH_DIST("pc_map_sim (5)") {
 		for(i=0; i<5; i++){
 			g1_new(p[i]);
 			g1_new(q[i]);
 		}
-		BENCH_ADD(pc_map_sim(r, p, q, 5));
+		BENCH_DIST_ADD(pc_map_sim(r, p, q, 5));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 
-	BENCH_RUN("pc_map_sim (8)") {
+	BENCH_DIST("pc_map_sim (8)") {
 		for(i=0; i<8; i++){
 			g1_new(p[i]);
 			g1_new(q[i]);
 		}
-		BENCH_ADD(pc_map_sim(r, p, q, 8));
+		BENCH_DIST_ADD(pc_map_sim(r, p, q, 8));
 	}
-	BENCH_END;
+	BENCH_DIST_END;
 	for(i=0; i<8; i++){
 		g1_free(p[i]);
 		g2_free(q[i]);
@@ -831,12 +966,14 @@ static void pairing(void) {
 	gt_free(r);
 }
 
-int main(void) {
+int main(int argc, char *argv[]) {
 	if (core_init() != RLC_OK) {
 		core_clean();
 		return 1;
 	}
 
+	bench_args(argc, argv);
+
 	conf_print();
 	util_banner("Benchmarks for the PC module:", 0);
 
@@ -44,11 +44,8 @@ static void G1(void) {
 	ep_t p, q;
 	bn_t k;
 	fp_t f1, f2, f3;
-	fp_t tab[FP_PRIME];
 	ep_null(p);
 	ep_new(p);
-	ep_null(p2);
-	ep_new(p2);
 	ep_null(q);
 	ep_new(q);
 	bn_null(k);
@@ -59,62 +56,102 @@ static void G1(void) {
     fp_new(f1);
     fp_new(f2);
     fp_new(f3);
-	BENCH_RUN("g1_map") {
+	BENCH_DIST("g1_map") {
 		uint8_t msg[5];
 		rand_bytes(msg, 5);
-		BENCH_ADD(ep_map(p, msg, 5));
-	} BENCH_END;
+		BENCH_DIST_ADD(ep_map(p, msg, 5));
+	} BENCH_DIST_END;
 
+	BENCH_DIST("g1_mul_cof (h)") {
+		ep_rand(p);
+		ep_curve_get_cof(k);
+		BENCH_DIST_ADD(ep_mul_dig(q, p, k->dp[0]));
+	} BENCH_DIST_END;
+
+	BENCH_DIST("g1_mul_cof") {
+		ep_rand(p);
+		BENCH_DIST_ADD(ep_mul_cof(q, p));
+	} BENCH_DIST_END;
+
+	BENCH_DIST("g1_mul_basic (z)") {
+		ep_rand(p);
+		fp_prime_get_par(k);
+		BENCH_DIST_ADD(ep_mul_basic(q, p, k));
+	} BENCH_DIST_END;
 
-	BENCH_RUN("g1_is_valid") {
+	BENCH_DIST("g1_mul_z") {
 		ep_rand(p);
-		BENCH_ADD(g1_is_valid_bw13(p));
-	} BENCH_END;
+		BENCH_DIST_ADD(ep_mul_z(q, p));
+	} BENCH_DIST_END;
 
-	BENCH_RUN("tate_exp1") {
+	BENCH_DIST("g1_is_valid") {
+		ep_rand(p);
+		BENCH_DIST_ADD(g1_is_valid_bw13(p));
+	} BENCH_DIST_END;
+
+	BENCH_DIST("tate_exp1") {
 		g1_rand(p);
 		fp_rand(f2);
 		fp_rand(f3);
-		BENCH_ADD(tate_exp1(f1, f2, f3));
-	} BENCH_END;
+		BENCH_DIST_ADD(tate_exp1(f1, f2, f3));
+	} BENCH_DIST_END;
 
-	BENCH_RUN("tate_exp2") {
+	BENCH_DIST("tate_exp2") {
 		g1_rand(p);
 		fp_rand(f2);
-		BENCH_ADD(tate_exp2(f1, f2));
-	} BENCH_END;
+		BENCH_DIST_ADD(tate_exp2(f1, f2));
+	} BENCH_DIST_END;
 
 
-	BENCH_RUN("g1_is_valid_tate") {
+	BENCH_DIST("g1_is_valid_tate") {
 		g1_tate_gen(q);
 		g1_rand(p);
-		BENCH_ADD(g1_is_valid_tate(p, q));
-	} BENCH_END;
+		BENCH_DIST_ADD(g1_is_valid_tate(p, q));
+	} BENCH_DIST_END;
 
-	BENCH_RUN("g1_is_valid_tate_pre") {
-		g1_tate_gen(q);
-		miller_tab(tab, q);
+	BENCH_DIST("g1_is_valid_tate_pre") {
 		g1_rand(p);
-		BENCH_ADD(g1_is_valid_tate_pre(p, q, tab));
-	} BENCH_END;
+		BENCH_DIST_ADD(g1_is_valid_tate_ctx(p));
+	} BENCH_DIST_END;
 
-	BENCH_RUN("g1_mul") {
+	BENCH_DIST("g1_mul") {
 		bn_rand(k, RLC_POS, 256);
 		ep_rand(p);
-		BENCH_ADD(ep_mul(q, p, k));
-	}BENCH_END;
+		BENCH_DIST_ADD(ep_mul(q, p, k));
+	}BENCH_DIST_END;
 
 	bn_free(k);
 	ep_free(p);
-	ep_free(p2);
 	ep_free(q);
   	fp_free(f1);
     fp_free(f2);
     fp_free(f3);
 }
 
+/**
+ * Checks one element of an array of G_2 points for bench_par().
+ *
+ * @param[in] a				- the array.
+ * @param[in] i				- the index of the element.
+ */
+static void g2_is_valid_one(void *a, int i) {
+	g2_is_valid_bw13(((ep13_t *)a)[i]);
+}
+
+/**
+ * Checks one element of an array of G_T elements for bench_par().
+ *
+ * @param[in] a				- the array.
+ * @param[in] i				- the index of the element.
+ */
+static void gt_is_valid_one(void *a, int i) {
+	gt_is_valid_bw13(((fp13_t *)a)[i]);
+}
+
 static void G2(void) {
-	ep13_t p, q;
+	ep13_t p, q, t[64];
+	char label[RLC_BENCH_LABEL];
+	int res[64];
 	bn_t k;
 	ep13_null(p);
 	ep13_new(p);
@@ -122,22 +159,55 @@ static void G2(void) {
 	ep13_new(q);
 	bn_null(k);
         bn_new(k);
-	BENCH_RUN("g2_map") {
+	BENCH_DIST("g2_map") {
 		uint8_t msg[5];
 		rand_bytes(msg, 5);
-		BENCH_ADD(ep13_map(p, msg, 5));
-	} BENCH_END;
+		BENCH_DIST_ADD(ep13_map(p, msg, 5));
+	} BENCH_DIST_END;
 
-	BENCH_RUN("g2_is_valid") {
+	BENCH_DIST("g2_mul_basic (z)") {
 		ep13_rand(p);
-		BENCH_ADD(g2_is_valid_bw13(p));
-	} BENCH_END;
+		fp_prime_get_par(k);
+		BENCH_DIST_ADD(ep13_mul_basic(q, p, k));
+	} BENCH_DIST_END;
 
-	BENCH_RUN("g2_mul") {
+	BENCH_DIST("g2_mul_z") {
+		ep13_rand(p);
+		BENCH_DIST_ADD(ep13_mul_z(q, p));
+	} BENCH_DIST_END;
+
+	BENCH_DIST("g2_is_valid") {
+		ep13_rand(p);
+		BENCH_DIST_ADD(g2_is_valid_bw13(p));
+	} BENCH_DIST_END;
+
+	for (int i = 0; i < 64; i++) {
+		ep13_null(t[i]);
+		ep13_new(t[i]);
+		ep13_rand(t[i]);
+	}
+	for (int j = 1; j <= RLC_MAX(CORES, 1); j++) {
+		bench_reset();
+		snprintf(label, sizeof(label), "g2_is_valid_lot (%d)", j);
+		bench_label(label);
+		bench_before();
+		for (int i = 0; i < BENCH; i++) {
+			g2_is_valid_bw13_lot(res, t, 64, j);
+		}
+		bench_after();
+		bench_compute(BENCH * 64);
+		bench_print();
+	}
+	bench_par("g2_is_valid_par", g2_is_valid_one, t, 64);
+	for (int i = 0; i < 64; i++) {
+		ep13_free(t[i]);
+	}
+
+	BENCH_DIST("g2_mul") {
 		bn_rand(k, RLC_POS, 256);
 		ep13_rand(p);
-		BENCH_ADD(ep13_mul(q, p, k));
-	}BENCH_END;
+		BENCH_DIST_ADD(ep13_mul(q, p, k));
+	}BENCH_DIST_END;
 
 	ep13_free(p);
 	ep13_free(q);
@@ -145,7 +215,9 @@ static void G2(void) {
 }
 
 static void Gt(void) {
-	fp13_t h0, h1;
+	fp13_t h0, h1, t[64];
+	char label[RLC_BENCH_LABEL];
+	int res[64];
 	fp13_null(h0);
 	fp13_null(h1);
 	fp13_new(h0);
@@ -154,20 +226,44 @@ static void Gt(void) {
 	bn_null(k);
     bn_new(k);
 	
-	BENCH_RUN("gt_is_valid") {
+	BENCH_DIST("gt_is_valid") {
 		fp13_rand(h0);
 		fp13_rand(h1);
 		pp_exp_bwk13(h0, h0, h1); 
-		BENCH_ADD(gt_is_valid_bw13(h0));
-	} BENCH_END;
+		BENCH_DIST_ADD(gt_is_valid_bw13(h0));
+	} BENCH_DIST_END;
+
+	for (int i = 0; i < 64; i++) {
+		fp13_null(t[i]);
+		fp13_new(t[i]);
+		fp13_rand(t[i]);
+		fp13_rand(h1);
+		pp_exp_bwk13(t[i], t[i], h1);
+	}
+	for (int j = 1; j <= RLC_MAX(CORES, 1); j++) {
+		bench_reset();
+		snprintf(label, sizeof(label), "gt_is_valid_lot (%d)", j);
+		bench_label(label);
+		bench_before();
+		for (int i = 0; i < BENCH; i++) {
+			gt_is_valid_bw13_lot(res, t, 64, j);
+		}
+		bench_after();
+		bench_compute(BENCH * 64);
+		bench_print();
+	}
+	bench_par("gt_is_valid_par", gt_is_valid_one, t, 64);
+	for (int i = 0; i < 64; i++) {
+		fp13_free(t[i]);
+	}
 
-	BENCH_RUN("gt_exp") {
+	BENCH_DIST("gt_exp") {
 		fp13_rand(h0);
 		fp13_rand(h1);
 		pp_exp_bwk13(h0, h0, h1);
 		bn_rand(k, RLC_POS, 256);
-		BENCH_ADD(fp13_exp_gt(h1, h0, k));
-	} BENCH_END;
+		BENCH_DIST_ADD(fp13_exp_gt(h1, h0, k));
+	} BENCH_DIST_END;
 
 	fp13_free(h0);
 	fp13_free(h1);
@@ -188,42 +284,42 @@ static void pairing(void) {
 	fp13_new(h0);
 	fp13_new(h1);
 
-	BENCH_RUN("pp_exp_bwk13") {
+	BENCH_DIST("pp_exp_bwk13") {
 		fp13_rand(h0);
 		fp13_rand(h1);
-		BENCH_ADD(pp_exp_bwk13(h0, h0, h1));
-	} BENCH_END;
+		BENCH_DIST_ADD(pp_exp_bwk13(h0, h0, h1));
+	} BENCH_DIST_END;
 
 
-	BENCH_RUN("pp_map_sup_oatep_k13") {
+	BENCH_DIST("pp_map_sup_oatep_k13") {
 		ep_rand(p[0]);
 		ep13_rand(q[0]);
-		BENCH_ADD(pp_map_sup_oatep_k13(h0, p[0], q[0]));
-	} BENCH_END;
+		BENCH_DIST_ADD(pp_map_sup_oatep_k13(h0, p[0], q[0]));
+	} BENCH_DIST_END;
 
-	BENCH_RUN("pp_map_sim_sup_oatep_k13(2)") {
+	BENCH_DIST("pp_map_sim_sup_oatep_k13(2)") {
 		for(i=0; i<2; i++){
 			ep_rand(p[i]);
 			ep13_rand(q[i]);
 		}
-		BENCH_ADD(pp_map_sim_sup_oatep_k13(h0, p, q, 2));
-	} BENCH_END;
+		BENCH_DIST_ADD(pp_map_sim_sup_oatep_k13(h0, p, q, 2));
+	} BENCH_DIST_END;
 
-	BENCH_RUN("pp_map_sim_sup_oatep_k13(5)") {
+	BENCH_DIST("pp_map_sim_sup_oatep_k13(5)") {
 		for(i=0; i<5; i++){
 			ep_rand(p[i]);
 			ep13_rand(q[i]);
 		}
-		BENCH_ADD(pp_map_sim_sup_oatep_k13(h0, p, q, 5));
-	} BENCH_END;	
+		BENCH_DIST_ADD(pp_map_sim_sup_oatep_k13(h0, p, q, 5));
+	} BENCH_DIST_END;	
 
-	BENCH_RUN("pp_map_sim_sup_oatep_k13(8)") {
+	BENCH_DIST("pp_map_sim_sup_oatep_k13(8)") {
 		for(i=0; i<8; i++){
 			ep_rand(p[i]);
 			ep13_rand(q[i]);
 		}
-		BENCH_ADD(pp_map_sim_sup_oatep_k13(h0, p, q, 8));
-	} BENCH_END;	
+		BENCH_DIST_ADD(pp_map_sim_sup_oatep_k13(h0, p, q, 8));
+	} BENCH_DIST_END;	
 
 for(i=0; i<8; i++){
 		ep_free(p[i]);
@@ -234,12 +330,14 @@ for(i=0; i<8; i++){
 
 }
 
-int main(void) {
+int main(int argc, char *argv[]) {
 	if (core_init() != RLC_OK) {
 		core_clean();
 		return 1;
 	}
 
+	bench_args(argc, argv);
+
 	conf_print();
 	util_banner("Benchmarks for the PC module:", 0);
 
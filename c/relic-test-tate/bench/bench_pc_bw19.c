@@ -0,0 +1,129 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2010 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Benchmarks for G_1 membership testing on BW19 curves.
+ *
+ * @ingroup bench
+ */
+
+#include <stdio.h>
+
+#include "relic.h"
+#include "relic_bench.h"
+
+static void G1(void) {
+	ep_t p, q;
+	bn_t k;
+	fp_t f1, f2, f3;
+
+	ep_null(p);
+	ep_null(q);
+	bn_null(k);
+	fp_null(f1);
+	fp_null(f2);
+	fp_null(f3);
+
+	ep_new(p);
+	ep_new(q);
+	bn_new(k);
+	fp_new(f1);
+	fp_new(f2);
+	fp_new(f3);
+
+	BENCH_RUN("g1_map") {
+		uint8_t msg[5];
+		rand_bytes(msg, 5);
+		BENCH_ADD(ep_map(p, msg, 5));
+	} BENCH_END;
+
+	BENCH_RUN("g1_is_valid (order)") {
+		ep_rand(p);
+		pc_get_ord(k);
+		BENCH_ADD(ep_mul_basic(q, p, k));
+	} BENCH_END;
+
+	BENCH_RUN("g1_is_valid") {
+		ep_rand(p);
+		BENCH_ADD(g1_is_valid(p));
+	} BENCH_END;
+
+	BENCH_RUN("tate_exp1") {
+		fp_rand(f3);
+		BENCH_ADD(tate_exp1(f1, f2, f3));
+	} BENCH_END;
+
+	BENCH_RUN("tate_exp2") {
+		fp_rand(f2);
+		BENCH_ADD(tate_exp2(f1, f2));
+	} BENCH_END;
+
+	BENCH_RUN("g1_is_valid_tate") {
+		g1_tate_get(q);
+		ep_rand(p);
+		BENCH_ADD(g1_is_valid_tate(p, q));
+	} BENCH_END;
+
+	BENCH_RUN("g1_is_valid_tate_ctx") {
+		ep_rand(p);
+		BENCH_ADD(g1_is_valid_tate_ctx(p));
+	} BENCH_END;
+
+	BENCH_RUN("g1_mul") {
+		bn_rand(k, RLC_POS, RLC_FP_BITS);
+		ep_rand(p);
+		BENCH_ADD(ep_mul(q, p, k));
+	} BENCH_END;
+
+	ep_free(p);
+	ep_free(q);
+	bn_free(k);
+	fp_free(f1);
+	fp_free(f2);
+	fp_free(f3);
+}
+
+int main(void) {
+	if (core_init() != RLC_OK) {
+		core_clean();
+		return 1;
+	}
+
+	conf_print();
+	util_banner("Benchmarks for the PC module:", 0);
+
+	if (ep_param_set_any_pairf() != RLC_OK || ep_curve_is_pairf() != EP_BW19) {
+		util_banner("Curve BW19 is not selected by FP_PRIME, skipping.", 0);
+		core_clean();
+		return 0;
+	}
+
+	ep_param_print();
+	util_banner("G1:", 0);
+	G1();
+
+	core_clean();
+	return 0;
+}
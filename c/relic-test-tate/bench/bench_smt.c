@@ -0,0 +1,259 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2023 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Benchmarks for subgroup membership testing and cofactor clearing, with the
+ * same labels on every curve so that results can be compared across presets.
+ *
+ * @ingroup bench
+ */
+
+#include <stdio.h>
+
+#include "relic.h"
+#include "relic_bench.h"
+
+/**
+ * Number of precomputed elements used when sampling is too expensive.
+ */
+#define POOL	64
+
+/**
+ * Checks if a point is in G_1 by multiplying it by the group order.
+ *
+ * @param[in] p				- the point to check.
+ * @param[in] n				- the group order.
+ * @return 1 if the point is in G_1, 0 otherwise.
+ */
+static int g1_is_valid_order(const g1_t p, const bn_t n) {
+	g1_t r;
+	int result = 0;
+
+	g1_null(r);
+
+	RLC_TRY {
+		g1_new(r);
+		g1_mul_any(r, p, n);
+		result = g1_on_curve(p) && g1_is_infty(r);
+	} RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	} RLC_FINALLY {
+		g1_free(r);
+	}
+	return result;
+}
+
+static void g1(void) {
+	g1_t p, q, r;
+	bn_t n;
+	const tate_tab_st *tab = g1_tate_get_tab();
+
+	g1_null(p);
+	g1_null(q);
+	g1_null(r);
+	bn_null(n);
+
+	g1_new(p);
+	g1_new(q);
+	g1_new(r);
+	bn_new(n);
+
+	BENCH_DIST("g1_is_valid") {
+		g1_rand(p);
+		BENCH_DIST_ADD(g1_is_valid(p));
+	} BENCH_DIST_END;
+
+	if (ep_curve_is_pairf() == EP_BW13) {
+		BENCH_DIST("g1_is_valid_endom") {
+			g1_rand(p);
+			BENCH_DIST_ADD(g1_is_valid_bw13(p));
+		} BENCH_DIST_END;
+	} else {
+		BENCH_DIST("g1_is_valid_endom") {
+			g1_rand(p);
+			BENCH_DIST_ADD(g1_is_valid_endom(p));
+		} BENCH_DIST_END;
+	}
+
+	pc_get_ord(n);
+	BENCH_DIST("g1_is_valid_order") {
+		g1_rand(p);
+		BENCH_DIST_ADD(g1_is_valid_order(p, n));
+	} BENCH_DIST_END;
+
+	if (tab != NULL) {
+		g1_tate_get(q);
+		BENCH_DIST("g1_is_valid_tate") {
+			g1_rand(p);
+			BENCH_DIST_ADD(g1_is_valid_tate(p, q));
+		} BENCH_DIST_END;
+
+		BENCH_DIST("g1_is_valid_tate_pre") {
+			g1_rand(p);
+			BENCH_DIST_ADD(g1_is_valid_tate_pre(p, q, tab->tab));
+		} BENCH_DIST_END;
+	}
+
+	BENCH_DIST("g1_mul_cof") {
+		g1_rand(p);
+		BENCH_DIST_ADD(g1_mul_cof(r, p));
+	} BENCH_DIST_END;
+
+	g1_free(p);
+	g1_free(q);
+	g1_free(r);
+	bn_free(n);
+}
+
+static void g2(void) {
+	g2_t p, r;
+
+	g2_null(p);
+	g2_null(r);
+
+	g2_new(p);
+	g2_new(r);
+
+	BENCH_DIST("g2_is_valid") {
+		g2_rand(p);
+		BENCH_DIST_ADD(g2_is_valid(p));
+	} BENCH_DIST_END;
+
+	BENCH_DIST("g2_mul_cof") {
+		g2_rand(p);
+		BENCH_DIST_ADD(g2_mul_cof(r, p));
+	} BENCH_DIST_END;
+
+	g2_free(p);
+	g2_free(r);
+}
+
+static void gt(void) {
+	gt_t a[POOL];
+
+	for (int i = 0; i < POOL; i++) {
+		gt_null(a[i]);
+		gt_new(a[i]);
+		gt_rand(a[i]);
+	}
+
+	BENCH_DIST("gt_is_valid") {
+		BENCH_DIST_ADD(gt_is_valid(a[_b % POOL]));
+	} BENCH_DIST_END;
+
+	for (int i = 0; i < POOL; i++) {
+		gt_free(a[i]);
+	}
+}
+
+static void bw13(void) {
+	ep13_t p, r;
+	fp13_t a[POOL], t;
+
+	ep13_null(p);
+	ep13_null(r);
+	fp13_null(t);
+
+	ep13_new(p);
+	ep13_new(r);
+	fp13_new(t);
+
+	BENCH_DIST("g2_is_valid") {
+		ep13_rand(p);
+		BENCH_DIST_ADD(g2_is_valid_bw13(p));
+	} BENCH_DIST_END;
+
+	BENCH_DIST("g2_mul_cof") {
+		ep13_rand(p);
+		BENCH_DIST_ADD(ep13_cof(r, p));
+	} BENCH_DIST_END;
+
+	BENCH_DIST("g2_mul_cof_fuentes") {
+		ep13_rand(p);
+		BENCH_DIST_ADD(ep13_cof_fuentes(r, p));
+	} BENCH_DIST_END;
+
+	/* Sampling G_T needs a final exponentiation, so cycle over a pool. */
+	for (int i = 0; i < POOL; i++) {
+		fp13_null(a[i]);
+		fp13_new(a[i]);
+		fp13_rand(a[i]);
+		fp13_rand(t);
+		pp_exp_bwk13(a[i], a[i], t);
+	}
+
+	BENCH_DIST("gt_is_valid") {
+		BENCH_DIST_ADD(gt_is_valid_bw13(a[_b % POOL]));
+	} BENCH_DIST_END;
+
+	for (int i = 0; i < POOL; i++) {
+		fp13_free(a[i]);
+	}
+	ep13_free(p);
+	ep13_free(r);
+	fp13_free(t);
+}
+
+int main(int argc, char *argv[]) {
+	if (core_init() != RLC_OK) {
+		core_clean();
+		return 1;
+	}
+
+	bench_args(argc, argv);
+
+	conf_print();
+	util_banner("Benchmarks for subgroup membership testing:", 0);
+
+	if (ep_param_set_any_pairf() != RLC_OK) {
+		RLC_THROW(ERR_NO_CURVE);
+		core_clean();
+		return 0;
+	}
+
+	ep_param_print();
+	util_banner("Group G_1:", 0);
+	g1();
+
+	switch (ep_curve_is_pairf()) {
+		case EP_B12:
+		case EP_B24:
+			util_banner("Group G_2:", 0);
+			g2();
+			util_banner("Group G_T:", 0);
+			gt();
+			break;
+		case EP_BW13:
+			util_banner("Group G_2 and G_T:", 0);
+			bw13();
+			break;
+		default:
+			/* There is no G_2 or G_T arithmetic for the other curves here. */
+			break;
+	}
+
+	core_clean();
+	return 0;
+}
@@ -6,6 +6,7 @@ message("      FP_PRIME=n        The prime modulus size in bits.")
 message("      FP_KARAT=n        The number of Karatsuba levels.")
 message("      FP_PMERS=[off|on] Prefer Pseudo-Mersenne primes over random primes.")
 message("      FP_QNRES=[off|on] Use -1 as quadratic non-residue (make sure that p = 3 mod 8).")
+message("      FP_COUNT=[off|on] Count prime field operations for cost analysis.")
 
 message("   ** Available prime field arithmetic methods (default = BASIC;COMBA;COMBA;MONTY;MONTY;JMPDS;SLIDE):")
 
@@ -63,6 +64,7 @@ set(FP_KARAT ${FP_KARAT} CACHE STRING "Number of Karatsuba levels.")
 
 option(FP_PMERS "Prefer special form primes over random primes." off)
 option(FP_QNRES "Use -1 as quadratic non-residue." off)
+option(FP_COUNT "Count prime field operations for cost analysis." off)
 
 # Choose the arithmetic methods.
 if (NOT FP_METHD)
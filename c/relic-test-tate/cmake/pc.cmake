@@ -0,0 +1,35 @@
+message(STATUS "Pairing-based cryptography configuration (PC module):\n")
+
+message("   ** Available pairing-based cryptography methods (default = AUTO):\n")
+
+message("      Subgroup membership testing in G_1:")
+message("      PC_METHD=ENDOM    Endomorphism-based formulas, order check otherwise.")
+message("      PC_METHD=TATE     Tate-based test with precomputed Miller table.")
+message("      PC_METHD=ORDER    Explicit multiplication by the group order.")
+message("      PC_METHD=AUTO     Fastest of TATE and ENDOM for the chosen prime.\n")
+
+# Choose the arithmetic methods.
+if (NOT PC_METHD)
+	set(PC_METHD "AUTO")
+endif(NOT PC_METHD)
+list(LENGTH PC_METHD PC_LEN)
+if (PC_LEN LESS 1)
+	message(FATAL_ERROR "Incomplete PC_METHD specification: ${PC_METHD}")
+endif(PC_LEN LESS 1)
+
+list(GET PC_METHD 0 PC_SMT)
+
+# Primes for which the precomputed Tate test beats the endomorphism-based
+# formulas, as measured by bench_pc, bench_pc_bw13 and bench_pc_bw19 on x64-asm
+# presets.
+set(PC_TATE_PRIMES 286 310 315 509 575)
+if (PC_SMT STREQUAL "AUTO")
+	list(FIND PC_TATE_PRIMES "${FP_PRIME}" PC_IDX)
+	if (EP_ENDOM AND NOT PC_IDX EQUAL -1)
+		set(PC_SMT "TATE")
+	else()
+		set(PC_SMT "ENDOM")
+	endif()
+	message(STATUS "Selected membership test for FP_PRIME=${FP_PRIME}: ${PC_SMT}")
+endif()
+set(PC_METHD ${PC_METHD} CACHE STRING "Method for pairing-based cryptography.")
@@ -0,0 +1,104 @@
+/*
+ * Writes a snapshot of the pairing parameters chosen by pc_param_set_any(),
+ * either as a binary file or as a C source defining a byte array, and reports
+ * how long it takes to set the parameters and to load the snapshot back.
+ *
+ * Usage: snapshot FILE         writes the binary snapshot to FILE.
+ *        snapshot -c NAME FILE writes a C array called NAME to FILE.
+ *
+ * A verifier built against the same library then starts with:
+ *
+ *     core_init();
+ *     if (core_read_bin(NAME, NAME_len) != RLC_OK) {
+ *         pc_param_set_any();
+ *     }
+ *
+ * To embed the array at build time, run this program from an
+ * add_custom_command() rule and add the generated file to the sources.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "relic.h"
+
+static long long elapsed(struct timespec *t0) {
+	struct timespec t1;
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	return ((long long)t1.tv_sec - t0->tv_sec) * 1000000000 +
+			(t1.tv_nsec - t0->tv_nsec);
+}
+
+int main(int argc, char *argv[]) {
+	const char *name = NULL, *path;
+	struct timespec t0;
+	uint8_t *bin = NULL;
+	long long ns;
+	size_t len, i;
+	FILE *f;
+
+	if (argc == 4 && strcmp(argv[1], "-c") == 0) {
+		name = argv[2];
+		path = argv[3];
+	} else if (argc == 2) {
+		path = argv[1];
+	} else {
+		fprintf(stderr, "usage: %s [-c NAME] FILE\n", argv[0]);
+		return 1;
+	}
+
+	if (core_init() != RLC_OK) {
+		core_clean();
+		return 1;
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	if (pc_param_set_any() != RLC_OK) {
+		core_clean();
+		return 1;
+	}
+	ns = elapsed(&t0);
+	fprintf(stderr, "pc_param_set_any: %lld us\n", ns / 1000);
+
+	len = core_size_bin();
+	if (len == 0 || (bin = (uint8_t *)malloc(len)) == NULL) {
+		fprintf(stderr, "snapshots require ALLOC = AUTO\n");
+		core_clean();
+		return 1;
+	}
+	core_write_bin(bin, len);
+
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	if (core_read_bin(bin, len) != RLC_OK) {
+		free(bin);
+		core_clean();
+		return 1;
+	}
+	ns = elapsed(&t0);
+	fprintf(stderr, "core_read_bin: %lld us (%zu bytes)\n", ns / 1000, len);
+
+	f = fopen(path, "wb");
+	if (f == NULL) {
+		free(bin);
+		core_clean();
+		return 1;
+	}
+	if (name == NULL) {
+		fwrite(bin, 1, len, f);
+	} else {
+		fprintf(f, "#include <stddef.h>\n#include <stdint.h>\n\n");
+		fprintf(f, "/* Generated for RELIC %s, FP_PRIME = %d. */\n",
+				RLC_VERSION, FP_PRIME);
+		fprintf(f, "const uint8_t %s[%zu] = {", name, len);
+		for (i = 0; i < len; i++) {
+			fprintf(f, "%s0x%02x,", (i % 16 == 0 ? "\n\t" : " "), bin[i]);
+		}
+		fprintf(f, "\n};\n\nconst size_t %s_len = %zu;\n", name, len);
+	}
+	fclose(f);
+
+	free(bin);
+	core_clean();
+	return 0;
+}
@@ -329,6 +329,109 @@ void fp_invm_low(dig_t *c, const dig_t *a);
  */
 int fp_smbm_low(const dig_t *a);
 
+/**
+ * Low-level wrappers that update the operation counters enabled by FP_COUNT.
+ * Each one has the same interface as the wrapped function.
+ * @{
+ */
+/** Counting wrapper for fp_addn_low(). */
+dig_t fp_addn_cnt(dig_t *c, const dig_t *a, const dig_t *b);
+
+/** Counting wrapper for fp_addm_low(). */
+void fp_addm_cnt(dig_t *c, const dig_t *a, const dig_t *b);
+
+/** Counting wrapper for fp_addd_low(). */
+dig_t fp_addd_cnt(dig_t *c, const dig_t *a, const dig_t *b);
+
+/** Counting wrapper for fp_addc_low(). */
+void fp_addc_cnt(dig_t *c, const dig_t *a, const dig_t *b);
+
+/** Counting wrapper for fp_subn_low(). */
+dig_t fp_subn_cnt(dig_t *c, const dig_t *a, const dig_t *b);
+
+/** Counting wrapper for fp_subm_low(). */
+void fp_subm_cnt(dig_t *c, const dig_t *a, const dig_t *b);
+
+/** Counting wrapper for fp_subd_low(). */
+dig_t fp_subd_cnt(dig_t *c, const dig_t *a, const dig_t *b);
+
+/** Counting wrapper for fp_subc_low(). */
+void fp_subc_cnt(dig_t *c, const dig_t *a, const dig_t *b);
+
+/** Counting wrapper for fp_negm_low(). */
+void fp_negm_cnt(dig_t *c, const dig_t *a);
+
+/** Counting wrapper for fp_dbln_low(). */
+dig_t fp_dbln_cnt(dig_t *c, const dig_t *a);
+
+/** Counting wrapper for fp_dblm_low(). */
+void fp_dblm_cnt(dig_t *c, const dig_t *a);
+
+/** Counting wrapper for fp_hlvm_low(). */
+void fp_hlvm_cnt(dig_t *c, const dig_t *a);
+
+/** Counting wrapper for fp_muln_low(). */
+void fp_muln_cnt(dig_t *c, const dig_t *a, const dig_t *b);
+
+/** Counting wrapper for fp_mulm_low(). */
+void fp_mulm_cnt(dig_t *c, const dig_t *a, const dig_t *b);
+
+/** Counting wrapper for fp_sqrn_low(). */
+void fp_sqrn_cnt(dig_t *c, const dig_t *a);
+
+/** Counting wrapper for fp_sqrm_low(). */
+void fp_sqrm_cnt(dig_t *c, const dig_t *a);
+
+/** Counting wrapper for fp_rdcn_low(). */
+void fp_rdcn_cnt(dig_t *c, dig_t *a);
+
+/** Counting wrapper for fp_invm_low(). */
+void fp_invm_cnt(dig_t *c, const dig_t *a);
+/** @} */
+
+/*
+ * Route the low-level operations through the counting wrappers. The low-level
+ * backends and the wrappers themselves are built with FP_NO_COUNT.
+ */
+#if defined(FP_COUNT) && !defined(FP_NO_COUNT)
+#undef fp_addn_low
+#define fp_addn_low(C, A, B)	fp_addn_cnt(C, A, B)
+#undef fp_addm_low
+#define fp_addm_low(C, A, B)	fp_addm_cnt(C, A, B)
+#undef fp_addd_low
+#define fp_addd_low(C, A, B)	fp_addd_cnt(C, A, B)
+#undef fp_addc_low
+#define fp_addc_low(C, A, B)	fp_addc_cnt(C, A, B)
+#undef fp_subn_low
+#define fp_subn_low(C, A, B)	fp_subn_cnt(C, A, B)
+#undef fp_subm_low
+#define fp_subm_low(C, A, B)	fp_subm_cnt(C, A, B)
+#undef fp_subd_low
+#define fp_subd_low(C, A, B)	fp_subd_cnt(C, A, B)
+#undef fp_subc_low
+#define fp_subc_low(C, A, B)	fp_subc_cnt(C, A, B)
+#undef fp_negm_low
+#define fp_negm_low(C, A)		fp_negm_cnt(C, A)
+#undef fp_dbln_low
+#define fp_dbln_low(C, A)		fp_dbln_cnt(C, A)
+#undef fp_dblm_low
+#define fp_dblm_low(C, A)		fp_dblm_cnt(C, A)
+#undef fp_hlvm_low
+#define fp_hlvm_low(C, A)		fp_hlvm_cnt(C, A)
+#undef fp_muln_low
+#define fp_muln_low(C, A, B)	fp_muln_cnt(C, A, B)
+#undef fp_mulm_low
+#define fp_mulm_low(C, A, B)	fp_mulm_cnt(C, A, B)
+#undef fp_sqrn_low
+#define fp_sqrn_low(C, A)		fp_sqrn_cnt(C, A)
+#undef fp_sqrm_low
+#define fp_sqrm_low(C, A)		fp_sqrm_cnt(C, A)
+#undef fp_rdcn_low
+#define fp_rdcn_low(C, A)		fp_rdcn_cnt(C, A)
+#undef fp_invm_low
+#define fp_invm_low(C, A)		fp_invm_cnt(C, A)
+#endif
+
 #endif /* ASM */
 
 #endif /* !RLC_FP_LOW_H */
@@ -24,12 +24,98 @@
 /**
  * @file
  *
- * Implementation of the auxiliary memory allocation functions.
+ * Interface of the auxiliary memory allocation functions.
  *
  * @ingroup utils
  */
 
+#ifndef RLC_ALLOC_H
+#define RLC_ALLOC_H
+
+#include <stddef.h>
+#include <stdlib.h>
+
 #include "relic_conf.h"
+#include "relic_label.h"
+
+/*============================================================================*/
+/* Constant definitions                                                       */
+/*============================================================================*/
+
+/**
+ * Size in bytes of the chunk backing the arena of each thread. Allocations that
+ * do not fit in the chunk fall back to the system allocator.
+ */
+#define RLC_ARENA_SIZE		(1 << 20)
+
+/*============================================================================*/
+/* Macro definitions                                                          */
+/*============================================================================*/
+
+/**
+ * Allocates memory for library objects with the chosen allocation policy.
+ *
+ * @param[in] S					- the number of bytes to allocate.
+ */
+#if ALLOC == ARENA
+#define RLC_MALLOC(S)			arena_malloc(S)
+#else
+#define RLC_MALLOC(S)			malloc(S)
+#endif
+
+/**
+ * Allocates zeroed memory for library objects with the chosen allocation
+ * policy.
+ *
+ * @param[in] N					- the number of objects to allocate.
+ * @param[in] S					- the size in bytes of each object.
+ */
+#if ALLOC == ARENA
+#define RLC_CALLOC(N, S)		arena_calloc(N, S)
+#else
+#define RLC_CALLOC(N, S)		calloc(N, S)
+#endif
+
+/**
+ * Resizes memory allocated with RLC_MALLOC or RLC_CALLOC.
+ *
+ * @param[in] P					- the memory to resize.
+ * @param[in] S					- the new size in bytes.
+ */
+#if ALLOC == ARENA
+#define RLC_REALLOC(P, S)		arena_realloc(P, S)
+#else
+#define RLC_REALLOC(P, S)		realloc(P, S)
+#endif
+
+/**
+ * Releases memory allocated with RLC_MALLOC, RLC_CALLOC or RLC_REALLOC.
+ *
+ * @param[in] P					- the memory to release.
+ */
+#if ALLOC == ARENA
+#define RLC_DEALLOC(P)			arena_free((void *)(P))
+#else
+#define RLC_DEALLOC(P)			free((void *)(P))
+#endif
+
+/**
+ * Marks the top of the arena of the calling thread. Without ALLOC = ARENA,
+ * there is nothing to mark.
+ */
+#if ALLOC != ARENA
+#define arena_mark()			((size_t)0)
+#endif
+
+/**
+ * Releases the arena of the calling thread back to a mark. Without
+ * ALLOC = ARENA, there is nothing to release.
+ *
+ * @param[in] M					- the mark.
+ */
+#if ALLOC != ARENA
+#define arena_release(M)		(void)(M)
+#endif
 
 #if defined(_MSC_VER) || defined(__MINGW32__) || defined(__MINGW64__)
 
@@ -44,8 +130,8 @@
  * @param[in] T                 - the type of each object.
  * @param[in] S                 - the number of obecs to allocate.
  */
-#if ALLOC == DYNAMIC
-#define RLC_ALLOCA(T, S)		(T*) calloc((S), sizeof(T))
+#if ALLOC != AUTO
+#define RLC_ALLOCA(T, S)		(T*) RLC_CALLOC((S), sizeof(T))
 #else
 #define RLC_ALLOCA(T, S)		(T*) _alloca((S) * sizeof(T))
 #endif
@@ -67,8 +153,8 @@
  * @param[in] T                 - the type of each object.
  * @param[in] S                 - the number of obecs to allocate.
  */
-#if ALLOC == DYNAMIC
-#define RLC_ALLOCA(T, S)		(T*) malloc((S) * sizeof(T))
+#if ALLOC != AUTO
+#define RLC_ALLOCA(T, S)		(T*) RLC_MALLOC((S) * sizeof(T))
 #else
 #define RLC_ALLOCA(T, S)		(T*) alloca((S) * sizeof(T))
 #endif
@@ -80,12 +166,77 @@
  *
  * @param[in] A					- the variable to free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define RLC_FREE(A)															\
 	if (A != NULL) {														\
-		free((void *)A);													\
+		RLC_DEALLOC(A);														\
 		A = NULL;															\
 	}
 #else
 #define RLC_FREE(A)         	(void)A;
 #endif
+
+/*============================================================================*/
+/* Function prototypes                                                        */
+/*============================================================================*/
+
+#if ALLOC == ARENA
+
+/**
+ * Allocates memory from the arena of the calling thread.
+ *
+ * @param[in] size			- the number of bytes to allocate.
+ * @return the allocated memory, or NULL if there is no available memory.
+ */
+void *arena_malloc(size_t size);
+
+/**
+ * Allocates zeroed memory from the arena of the calling thread.
+ *
+ * @param[in] num			- the number of objects to allocate.
+ * @param[in] size			- the size in bytes of each object.
+ * @return the allocated memory, or NULL if there is no available memory.
+ */
+void *arena_calloc(size_t num, size_t size);
+
+/**
+ * Resizes memory allocated from an arena, preserving its contents.
+ *
+ * @param[in] ptr			- the memory to resize, or NULL.
+ * @param[in] size			- the new size in bytes.
+ * @return the resized memory, or NULL if there is no available memory.
+ */
+void *arena_realloc(void *ptr, size_t size);
+
+/**
+ * Releases memory allocated from an arena. The memory may belong to the arena
+ * of another thread.
+ *
+ * @param[in] ptr			- the memory to release, or NULL.
+ */
+void arena_free(void *ptr);
+
+/**
+ * Returns the current top of the arena of the calling thread.
+ *
+ * @return the mark.
+ */
+size_t arena_mark(void);
+
+/**
+ * Releases at once all memory allocated by the calling thread since a mark.
+ * Objects allocated after the mark must not be used or freed afterwards.
+ *
+ * @param[in] mark			- the mark returned by arena_mark().
+ */
+void arena_release(size_t mark);
+
+/**
+ * Detaches the arena from the calling thread. The arena is freed as soon as
+ * the memory allocated from it and still in use is released.
+ */
+void arena_clean(void);
+
+#endif
+
+#endif /* !RLC_ALLOC_H */
@@ -48,6 +48,20 @@
 #include <linux/perf_event.h>
 #endif
 
+/*============================================================================*/
+/* Constant definitions                                                       */
+/*============================================================================*/
+
+/**
+ * Maximum length of a benchmark label.
+ */
+#define RLC_BENCH_LABEL		64
+
+/**
+ * Number of consecutive inputs processed by a thread in bench_par().
+ */
+#define RLC_BENCH_CHUNK		16
+
 /*============================================================================*/
 /* Macro definitions                                                          */
 /*============================================================================*/
@@ -61,7 +75,7 @@
  */
 #define BENCH_ONE(LABEL, FUNCTION, N)										\
 	bench_reset();															\
-	util_print("BENCH: " LABEL "%*c = ", (int)(32 - strlen(LABEL)), ' ');	\
+	bench_label(LABEL);														\
 	bench_before();															\
 	FUNCTION;																\
 	bench_after();															\
@@ -78,7 +92,7 @@
  */
 #define BENCH_FEW(LABEL, FUNCTION, N)										\
 	bench_reset();															\
-	util_print("BENCH: " LABEL "%*c = ", (int)(32 - strlen(LABEL)), ' ');	\
+	bench_label(LABEL);														\
 	bench_before();															\
 	for (int i = 0; i < BENCH; i++)	{										\
 		FUNCTION;															\
@@ -94,7 +108,7 @@
  */
 #define BENCH_RUN(LABEL)													\
 	bench_reset();															\
-	util_print("BENCH: " LABEL "%*c = ", (int)(32 - strlen(LABEL)), ' ');	\
+	bench_label(LABEL);														\
 	for (int _b = 0; _b < BENCH; _b++)	{									\
 
 /**
@@ -128,10 +142,65 @@
 	}																		\
 	bench_after();															\
 
+/**
+ * Runs a new benchmark that measures the distribution of latencies. Each of
+ * the BENCH * BENCH iterations should draw fresh inputs before timing a single
+ * call with BENCH_DIST_ADD.
+ *
+ * @param[in] LABEL			- the label for this benchmark.
+ */
+#define BENCH_DIST(LABEL)													\
+	bench_reset();															\
+	bench_label(LABEL);														\
+	for (int _b = 0; _b < BENCH * BENCH; _b++) {							\
+
+/**
+ * Measures the time of one execution and records it as a sample.
+ *
+ * @param[in] FUNCTION		- the function executed.
+ */
+#define BENCH_DIST_ADD(FUNCTION)											\
+	if (_b == 0) FUNCTION;													\
+	bench_before();															\
+	FUNCTION;																\
+	bench_sample();															\
+
+/**
+ * Prints the mean, percentiles and maximum of the recorded samples.
+ */
+#define BENCH_DIST_END														\
+	}																		\
+	bench_dist()															\
+
+/**
+ * Runs a function once and prints the prime field operations it executed.
+ * The counts are only available when the library is built with FP_COUNT.
+ * @param[in] LABEL			- the label for this benchmark.
+ * @param[in] FUNCTION		- the function to count.
+ */
+#define BENCH_COUNT(LABEL, FUNCTION)										\
+	util_print("COUNT: " LABEL "%*c = ", (int)(32 - strlen(LABEL)), ' ');	\
+	bench_count_before();													\
+	FUNCTION;																\
+	bench_count_after();													\
+	bench_count_print();													\
+
 /*============================================================================*/
 /* Type definitions                                                           */
 /*============================================================================*/
 
+/**
+ * Formats for the machine-readable benchmark records.
+ */
+enum {
+	/** No records are written. */
+	BENCH_TEXT,
+	/** One line of comma-separated values per benchmark. */
+	BENCH_CSV,
+	/** One JSON object per line per benchmark. */
+	BENCH_JSON
+};
+
 /**
  * Timer type.
  */
@@ -187,6 +256,23 @@ void bench_overhead(void);
  */
 void bench_reset(void);
 
+/**
+ * Parses the command-line options of a benchmark program. The options are
+ * "--csv FILE" and "--json FILE" to also write one record per benchmark to
+ * FILE, and "--threads N" to choose the number of threads used by bench_par().
+ *
+ * @param[in] argc			- the number of arguments.
+ * @param[in] argv			- the arguments.
+ */
+void bench_args(int argc, char *argv[]);
+
+/**
+ * Sets the label of the current benchmark and prints it.
+ *
+ * @param[in] label			- the benchmark label.
+ */
+void bench_label(const char *label);
+
 /**
  * Measures the time before a benchmark is executed.
  */
@@ -209,6 +295,28 @@ void bench_compute(int benches);
  */
 void bench_print(void);
 
+/**
+ * Measures the time after a single execution and records it as a sample,
+ * discounting the cost of the timer itself.
+ */
+void bench_sample(void);
+
+/**
+ * Computes and prints the distribution of the recorded samples.
+ */
+void bench_dist(void);
+
+/**
+ * Measures the throughput of an operation by running it once on each of n
+ * precomputed inputs, distributed among the threads chosen by bench_args().
+ *
+ * @param[in] label			- the benchmark label.
+ * @param[in] f				- the operation, called with the inputs and an index.
+ * @param[in] args			- the inputs.
+ * @param[in] n				- the number of inputs.
+ */
+void bench_par(const char *label, void (*f)(void *, int), void *args, int n);
+
 /**
  * Returns the result of the last benchmark.
  *
@@ -216,4 +324,28 @@ void bench_print(void);
  */
 ull_t bench_total(void);
 
+/**
+ * Snapshots the prime field operation counters before a benchmark.
+ */
+void bench_count_before(void);
+
+/**
+ * Computes the prime field operations executed since the last snapshot.
+ */
+void bench_count_after(void);
+
+/**
+ * Returns the number of times an operation was executed in the last counted
+ * benchmark, or zero if the library was built without FP_COUNT.
+ *
+ * @param[in] op			- the operation, one of FP_OP_*.
+ * @return the operation count.
+ */
+ull_t bench_count(int op);
+
+/**
+ * Prints the operation counts of the last counted benchmark.
+ */
+void bench_count_print(void);
+
 #endif /* !RLC_BENCH_H */
@@ -99,10 +99,10 @@ typedef struct {
 	size_t used;
 	/** The sign of this multiple precision integer. */
 	int sign;
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 	/** The sequence of contiguous digits that forms this integer. */
 	dig_t *dp;
-#elif ALLOC == AUTO
+#else
 	/** The sequence of contiguous digits that forms this integer. */
 	rlc_align dig_t dp[RLC_BN_SIZE];
 #endif
@@ -113,7 +113,7 @@ typedef struct {
  */
 #if ALLOC == AUTO
 typedef bn_st bn_t[1];
-#elif ALLOC == DYNAMIC
+#else
 #ifdef CHECK
 typedef bn_st *volatile bn_t;
 #else
@@ -156,7 +156,7 @@ typedef crt_st *crt_t;
  */
 #if ALLOC == AUTO
 #define bn_null(A)			/* empty */
-#elif ALLOC == DYNAMIC
+#else
 #define bn_null(A)			A = NULL;
 #endif
 
@@ -166,15 +166,15 @@ typedef crt_st *crt_t;
  * @param[in,out] A			- the multiple precision integer to initialize.
  * @throw ERR_NO_MEMORY		- if there is no available memory.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define bn_new(A)															\
-	A = (bn_t)calloc(1, sizeof(bn_st));										\
+	A = (bn_t)RLC_CALLOC(1, sizeof(bn_st));									\
 	if ((A) == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
 	bn_make(A, RLC_BN_SIZE);												\
 
-#elif ALLOC == AUTO
+#else
 #define bn_new(A)															\
 	bn_make(A, RLC_BN_SIZE);												\
 
@@ -190,15 +190,15 @@ typedef crt_st *crt_t;
  * @throw ERR_PRECISION		- if the required precision cannot be represented
  *							by the library.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define bn_new_size(A, D)													\
-	A = (bn_t)calloc(1, sizeof(bn_st));										\
+	A = (bn_t)RLC_CALLOC(1, sizeof(bn_st));									\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
 	bn_make(A, D);															\
 
-#elif ALLOC == AUTO
+#else
 #define bn_new_size(A, D)													\
 	bn_make(A, D);															\
 
@@ -209,15 +209,15 @@ typedef crt_st *crt_t;
  *
  * @param[in,out] A			- the multiple precision integer to free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define bn_free(A)															\
 	if (A != NULL) {														\
 		bn_clean(A);														\
-		free((void *)A);													\
+		RLC_DEALLOC(A);														\
 		A = NULL;															\
 	}
 
-#elif ALLOC == AUTO
+#else
 #define bn_free(A)			/* empty */										\
 
 #endif
@@ -234,9 +234,9 @@ typedef crt_st *crt_t;
  *
  * @param[out] A			- the new key pair.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define crt_new(A)															\
-	A = (crt_t)calloc(1, sizeof(crt_st));									\
+	A = (crt_t)RLC_CALLOC(1, sizeof(crt_st));								\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
@@ -247,7 +247,7 @@ typedef crt_st *crt_t;
 	bn_new((A)->q);															\
 	bn_new((A)->qi);														\
 
-#elif ALLOC == AUTO
+#else
 #define crt_new(A)															\
 	bn_new((A)->n);															\
 	bn_new((A)->dp);														\
@@ -263,7 +263,7 @@ typedef crt_st *crt_t;
  *
  * @param[out] A			- the key pair to clean and free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define crt_free(A)															\
 	if (A != NULL) {														\
 		bn_free((A)->n);													\
@@ -272,11 +272,11 @@ typedef crt_st *crt_t;
 		bn_free((A)->p);													\
 		bn_free((A)->q);													\
 		bn_free((A)->qi);													\
-		free(A);															\
+		RLC_DEALLOC(A);														\
 		A = NULL;															\
 	}
 
-#elif ALLOC == AUTO
+#else
 #define crt_free(A)				/* empty */
 
 #endif
@@ -130,9 +130,10 @@
 /*============================================================================*/
 
 /**
- * Library context.
+ * Per-thread library state, holding everything that changes while the library
+ * is used: the error state, the PRNG, benchmark timings and counters.
  */
-typedef struct _ctx_t {
+typedef struct _thr_t {
 	/** The value returned by the last call, can be RLC_OK or RLC_ERR. */
 	int code;
 
@@ -143,12 +144,89 @@ typedef struct _ctx_t {
 	sts_t error;
 	/** Error number to be used outside try-catch blocks. */
 	err_t number;
-	/** The error message respective to the last error. */
-	char *reason[ERR_MAX];
 	/** A flag to indicate if the last error was already caught. */
 	int caught;
 #endif /* CHECK */
 
+#if defined(WITH_FP) && defined(FP_COUNT)
+	/** Counters of prime field operations, indexed by FP_OP_*. */
+	ull_t fp_cnt[FP_OPS];
+	/** Nesting depth of counted operations, only the outermost is counted. */
+	int fp_lvl;
+#endif /* FP_COUNT */
+
+#if BENCH > 0
+	/** Stores the time measured before the execution of the benchmark. */
+	ben_t before;
+	/** Stores the time measured after the execution of the benchmark. */
+	ben_t after;
+	/** Stores the sum of timings for the current benchmark. */
+	ull_t total;
+	/** Stores the label of the current benchmark. */
+	char label[RLC_BENCH_LABEL];
+	/** Stores the timings of single executions in the current benchmark. */
+	ull_t *dist;
+	/** Stores the number of recorded timings. */
+	int dist_len;
+	/** Stores the cost of timing a single execution. */
+	ull_t dist_over;
+	/** Stores the number of threads used to measure throughput. */
+	int bench_thr;
+	/** Stores the format of the benchmark records. */
+	int bench_fmt;
+	/** Stores the file receiving the benchmark records. */
+	FILE *bench_out;
+#ifdef OVERH
+	/** Benchmarking overhead to be measured and subtracted from benchmarks. */
+	ull_t over;
+#endif
+#ifdef FP_COUNT
+	/** Stores the operation counters before the execution of the benchmark. */
+	ull_t cnt_before[FP_OPS];
+	/** Stores the operation counts of the last benchmark. */
+	ull_t cnt[FP_OPS];
+#endif
+#endif
+
+#if RAND != CALL
+	/** Internal state of the PRNG. */
+	uint8_t rand[RLC_RAND_SIZE];
+#else
+	void (*rand_call)(uint8_t *, int, void *);
+	void *rand_args;
+#endif
+	/** Flag to indicate if PRNG is seed. */
+	int seeded;
+	/** Counter to keep track of number of calls since last seeding. */
+	int counter;
+
+#if TIMER == PERF
+	/** File descriptor for perf system call. */
+	int perf_fd;
+	/** Buffer for storing perf data, */
+	struct perf_event_mmap_page *perf_buf;
+#endif
+
+#if ALLOC == ARENA
+	/** Arena serving the allocations of this thread, created on demand. */
+	void *arena;
+#endif
+
+	/** Number of contexts initialized by this thread and not yet finalized. */
+	int refs;
+} thr_t;
+
+/**
+ * Library context, holding the parameters and precomputed tables. Once
+ * initialized, the context is only read and can be shared by several threads,
+ * each keeping its own thr_t.
+ */
+typedef struct _ctx_t {
+#ifdef CHECK
+	/** The error message respective to the last error. */
+	char *reason[ERR_MAX];
+#endif /* CHECK */
+
 #ifdef WITH_FB
 	/** Identifier of the currently configured binary field. */
 	int fb_id;
@@ -454,38 +532,18 @@ typedef struct _ctx_t {
 
 #if defined(WITH_PC)
 	gt_t gt_g;
-#endif
-
-#if BENCH > 0
-	/** Stores the time measured before the execution of the benchmark. */
-	ben_t before;
-	/** Stores the time measured after the execution of the benchmark. */
-	ben_t after;
-	/** Stores the sum of timings for the current benchmark. */
-	ull_t total;
-#ifdef OVERH
-	/** Benchmarking overhead to be measured and subtracted from benchmarks. */
-	ull_t over;
-#endif
-#endif
-
-#if RAND != CALL
-	/** Internal state of the PRNG. */
-	uint8_t rand[RLC_RAND_SIZE];
-#else
-	void (*rand_call)(uint8_t *, int, void *);
-	void *rand_args;
-#endif
-	/** Flag to indicate if PRNG is seed. */
-	int seeded;
-	/** Counter to keep track of number of calls since last seeding. */
-	int counter;
-
-#if TIMER == PERF
-	/** File descriptor for perf system call. */
-	int perf_fd;
-	/** Buffer for storing perf data, */
-	struct perf_event_mmap_page *perf_buf;
+	/** The Miller loop schedule of the Tate-based membership test. */
+	uint8_t tate_op[RLC_FP_BITS + 1];
+	/** The number of steps in the Miller loop schedule. */
+	int tate_len;
+	/** The auxiliary point for the Tate-based membership test in G_1. */
+	g1_st tate_q;
+	/** The Miller table precomputed for the auxiliary point. */
+	tate_tab_st tate_tab;
+	/** Flag indicating if the vectorized Miller loop is used. */
+	int tate_vec;
+	/** The corrections for the radix of the vectorized Miller loop. */
+	fp_st tate_cor[2];
 #endif
 
 	/** Function pointer to underlying lznct implementation. */
@@ -494,6 +552,11 @@ typedef struct _ctx_t {
 #elif ARCH == X64 || ARCH == A64
 	unsigned int (*lzcnt_ptr)(ull_t);
 #endif
+
+	/** Number of threads using this context. */
+	int refs;
+	/** Flag to indicate if this context was allocated by core_init(). */
+	int alloc;
 } ctx_t;
 
 /*============================================================================*/
@@ -528,6 +591,58 @@ ctx_t *core_get(void);
  */
 void core_set(ctx_t *ctx);
 
+/**
+ * Returns a pointer to the state of the calling thread.
+ *
+ * @return a pointer to the thread state.
+ */
+thr_t *core_thr(void);
+
+/**
+ * Attaches the calling thread to a context initialized by another thread,
+ * sharing its parameters instead of computing new ones. The thread must call
+ * core_clean() when done, and the context is finalized by the last thread
+ * that releases it. Parameters must not be changed while the context is
+ * shared.
+ *
+ * @param[in] ctx					- the library context.
+ * @return RLC_OK if no error occurs, RLC_ERR otherwise.
+ */
+int core_attach(ctx_t *ctx);
+
+/**
+ * Returns the number of bytes needed to store a snapshot of the current
+ * context, or zero if snapshots are not supported by this configuration.
+ *
+ * @return the number of bytes.
+ */
+size_t core_size_bin(void);
+
+/**
+ * Writes a snapshot of the current context, including all parameters and
+ * precomputed tables, to a byte vector. The snapshot can only be read back by
+ * the same build of the library.
+ *
+ * @param[out] bin					- the byte vector.
+ * @param[in] len					- the buffer capacity.
+ * @throw ERR_NO_BUFFER				- if the buffer capacity is insufficient.
+ * @throw ERR_NO_CONFIG				- if the library was not built with
+ * 									  ALLOC = AUTO.
+ */
+void core_write_bin(uint8_t *bin, size_t len);
+
+/**
+ * Replaces the parameters of the current context, which must have been
+ * initialized with core_init(), by a snapshot written by core_write_bin().
+ * The snapshot is rejected if it was produced by another build or its
+ * checksum does not match, leaving the context unchanged.
+ *
+ * @param[in] bin					- the byte vector.
+ * @param[in] len					- the buffer size.
+ * @return RLC_OK if the snapshot was loaded, RLC_ERR otherwise.
+ */
+int core_read_bin(const uint8_t *bin, size_t len);
+
 #if defined(MULTI)
 
 #include "relic_multi.h"
@@ -278,9 +278,9 @@ typedef etrs_st *etrs_t;
  *
  * @param[out] A			- the new key pair.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define shpe_new(A)															\
-	A = (shpe_t)calloc(1, sizeof(shpe_st));									\
+	A = (shpe_t)RLC_CALLOC(1, sizeof(shpe_st));								\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
@@ -290,7 +290,7 @@ typedef etrs_st *etrs_t;
 	bn_new((A)->gn);														\
 	crt_new((A)->crt);														\
 
-#elif ALLOC == AUTO
+#else
 #define shpe_new(A)															\
 	bn_new((A)->a);															\
 	bn_new((A)->b);															\
@@ -305,7 +305,7 @@ typedef etrs_st *etrs_t;
  *
  * @param[out] A			- the key pair to clean and free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define shpe_free(A)														\
 	if (A != NULL) {														\
 		bn_free((A)->a);													\
@@ -313,11 +313,11 @@ typedef etrs_st *etrs_t;
 		bn_free((A)->g);													\
 		bn_free((A)->gn);													\
 		crt_free((A)->crt);													\
-		free(A);															\
+		RLC_DEALLOC(A);														\
 		A = NULL;															\
 	}
 
-#elif ALLOC == AUTO
+#else
 #define shpe_free(A)				/* empty */
 
 #endif
@@ -334,9 +334,9 @@ typedef etrs_st *etrs_t;
  *
  * @param[out] A			- the new key pair.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define rsa_new(A)															\
-	A = (rsa_t)calloc(1, sizeof(_rsa_st));									\
+	A = (rsa_t)RLC_CALLOC(1, sizeof(_rsa_st));								\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
@@ -346,7 +346,7 @@ typedef etrs_st *etrs_t;
 	bn_new((A)->e);															\
 	crt_new((A)->crt);														\
 
-#elif ALLOC == AUTO
+#else
 #define rsa_new(A)															\
 	bn_new((A)->d);															\
 	bn_new((A)->e);															\
@@ -359,17 +359,17 @@ typedef etrs_st *etrs_t;
  *
  * @param[out] A			- the key pair to clean and free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define rsa_free(A)															\
 	if (A != NULL) {														\
 		bn_free((A)->d);													\
 		bn_free((A)->e);													\
 		crt_free((A)->crt);													\
-		free(A);															\
+		RLC_DEALLOC(A);														\
 		A = NULL;															\
 	}
 
-#elif ALLOC == AUTO
+#else
 #define rsa_free(A)				/* empty */
 
 #endif
@@ -428,9 +428,9 @@ typedef etrs_st *etrs_t;
  *
  * @param[out] A			- the new key pair.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define bdpe_new(A)															\
-	A = (bdpe_t)calloc(1, sizeof(bdpe_st));									\
+	A = (bdpe_t)RLC_CALLOC(1, sizeof(bdpe_st));								\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
@@ -440,7 +440,7 @@ typedef etrs_st *etrs_t;
 	bn_new((A)->q);															\
 	(A)->t = 0;																\
 
-#elif ALLOC == AUTO
+#else
 #define bdpe_new(A)															\
 	bn_new((A)->n);															\
 	bn_new((A)->y);															\
@@ -455,7 +455,7 @@ typedef etrs_st *etrs_t;
  *
  * @param[out] A			- the key pair to clean and free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define bdpe_free(A)														\
 	if (A != NULL) {														\
 		bn_free((A)->n);													\
@@ -463,11 +463,11 @@ typedef etrs_st *etrs_t;
 		bn_free((A)->p);													\
 		bn_free((A)->q);													\
 		(A)->t = 0;															\
-		free(A);															\
+		RLC_DEALLOC(A);														\
 		A = NULL;															\
 	}
 
-#elif ALLOC == AUTO
+#else
 #define bdpe_free(A)			/* empty */
 #endif
 
@@ -483,16 +483,16 @@ typedef etrs_st *etrs_t;
  *
  * @param[out] A			- the new key pair.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define sokaka_new(A)														\
-	A = (sokaka_t)calloc(1, sizeof(sokaka_st));								\
+	A = (sokaka_t)RLC_CALLOC(1, sizeof(sokaka_st));							\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
 	g1_new((A)->s1);														\
 	g2_new((A)->s2);														\
 
-#elif ALLOC == AUTO
+#else
 #define sokaka_new(A)			/* empty */
 #endif
 
@@ -501,16 +501,16 @@ typedef etrs_st *etrs_t;
  *
  * @param[out] A			- the key pair to clean and free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define sokaka_free(A)														\
 	if (A != NULL) {														\
 		g1_free((A)->s1);													\
 		g2_free((A)->s2);													\
-		free(A);															\
+		RLC_DEALLOC(A);														\
 		A = NULL;															\
 	}
 
-#elif ALLOC == AUTO
+#else
 #define sokaka_free(A)			/* empty */
 #endif
 
@@ -526,9 +526,9 @@ typedef etrs_st *etrs_t;
  *
  * @param[out] A			- the new key pair.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define bgn_new(A)															\
-	A = (bgn_t)calloc(1, sizeof(bgn_st));									\
+	A = (bgn_t)RLC_CALLOC(1, sizeof(bgn_st));								\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
@@ -542,7 +542,7 @@ typedef etrs_st *etrs_t;
 	g2_new((A)->hy);														\
 	g2_new((A)->hz);														\
 
-#elif ALLOC == AUTO
+#else
 #define bgn_new(A)				/* empty */
 #endif
 
@@ -551,7 +551,7 @@ typedef etrs_st *etrs_t;
  *
  * @param[out] A			- the key pair to clean and free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define bgn_free(A)															\
 	if (A != NULL) {														\
 		bn_free((A)->x);													\
@@ -563,11 +563,11 @@ typedef etrs_st *etrs_t;
 		g2_free((A)->hx);													\
 		g2_free((A)->hy);													\
 		g2_free((A)->hz);													\
-		free(A);															\
+		RLC_DEALLOC(A);														\
 		A = NULL;															\
 	}
 
-#elif ALLOC == AUTO
+#else
 #define bgn_free(A)				/* empty */
 #endif
 
@@ -583,9 +583,9 @@ typedef etrs_st *etrs_t;
  *
  * @param[out] A			- the new signature ring.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define ers_new(A)															\
-	A = (ers_t)calloc(1, sizeof(ers_st));									\
+	A = (ers_t)RLC_CALLOC(1, sizeof(ers_st));								\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
@@ -596,7 +596,7 @@ typedef etrs_st *etrs_t;
 	bn_new((A)->r[0]);														\
 	bn_new((A)->r[1]);														\
 
-#elif ALLOC == AUTO
+#else
 #define ers_new(A)				/* empty */
 #endif
 
@@ -605,7 +605,7 @@ typedef etrs_st *etrs_t;
  *
  * @param[out] A			- the signature ring to clean and free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define ers_free(A)															\
 	if (A != NULL) {														\
 		ec_free((A)->h);													\
@@ -614,11 +614,11 @@ typedef etrs_st *etrs_t;
 		bn_free((A)->c[1]);													\
 		bn_free((A)->r[0]);													\
 		bn_free((A)->r[1]);													\
-		free(A);															\
+		RLC_DEALLOC(A);														\
 		A = NULL;															\
 	}
 
-#elif ALLOC == AUTO
+#else
 #define ers_free(A)				/* empty */
 #endif
 
@@ -634,9 +634,9 @@ typedef etrs_st *etrs_t;
  *
  * @param[out] A			- the new signature ring.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define smlers_new(A)														\
-	A = (smlers_t)calloc(1, sizeof(ers_st));								\
+	A = (smlers_t)RLC_CALLOC(1, sizeof(ers_st));							\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
@@ -647,7 +647,7 @@ typedef etrs_st *etrs_t;
 	bn_new((A)->r[0]);														\
 	bn_new((A)->r[1]);														\
 
-#elif ALLOC == AUTO
+#else
 #define smlers_new(A)		/* empty */
 #endif
 
@@ -656,7 +656,7 @@ typedef etrs_st *etrs_t;
  *
  * @param[out] A			- the signature ring to clean and free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define smlers_free(A)														\
 	if (A != NULL) {														\
 		ers_free((A)->sig);													\
@@ -665,11 +665,11 @@ typedef etrs_st *etrs_t;
 		bn_free((A)->c[1]);													\
 		bn_free((A)->r[0]);													\
 		bn_free((A)->r[1]);													\
-		free(A);															\
+		RLC_DEALLOC(A);														\
 		A = NULL;															\
 	}
 
-#elif ALLOC == AUTO
+#else
 #define smlers_free(A)		/* empty */
 #endif
 
@@ -685,9 +685,9 @@ typedef etrs_st *etrs_t;
  *
  * @param[out] A			- the new signature ring.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define etrs_new(A)															\
-	A = (etrs_t)calloc(1, sizeof(etrs_st));									\
+	A = (etrs_t)RLC_CALLOC(1, sizeof(etrs_st));								\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
@@ -699,7 +699,7 @@ typedef etrs_st *etrs_t;
 	bn_new((A)->r[0]);														\
 	bn_new((A)->r[1]);														\
 
-#elif ALLOC == AUTO
+#else
 #define etrs_new(A)			/* empty */
 
 #endif
@@ -709,7 +709,7 @@ typedef etrs_st *etrs_t;
  *
  * @param[out] A			- the signature ring to clean and free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define etrs_free(A)														\
 	if (A != NULL) {														\
 		bn_free((A)->y);													\
@@ -719,11 +719,11 @@ typedef etrs_st *etrs_t;
 		bn_free((A)->c[1]);													\
 		bn_free((A)->r[0]);													\
 		bn_free((A)->r[1]);													\
-		free(A);															\
+		RLC_DEALLOC(A);														\
 		A = NULL;															\
 	}
 
-#elif ALLOC == AUTO
+#else
 #define etrs_free(A)		/* empty */
 #endif
 
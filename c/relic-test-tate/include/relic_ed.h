@@ -154,14 +154,14 @@ typedef ed_st *ed_t;
  * @param[out] A			- the new point.
  * @throw ERR_NO_MEMORY		- if there is no available memory.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define ed_new(A)															\
-	A = (ed_t)calloc(1, sizeof(ed_st));										\
+	A = (ed_t)RLC_CALLOC(1, sizeof(ed_st));									\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}
 
-#elif ALLOC == AUTO
+#else
 #define ed_new(A)			/* empty */
 
 #endif
@@ -171,14 +171,14 @@ typedef ed_st *ed_t;
  *
  * @param[out] A			- the point to free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define ed_free(A)															\
 	if (A != NULL) {														\
-		free(A);															\
+		RLC_DEALLOC(A);														\
 		A = NULL;															\
 	}
 
-#elif ALLOC == AUTO
+#else
 #define ed_free(A)			/* empty */
 
 #endif
@@ -143,6 +143,8 @@ enum {
 	SS_P3072,
 	/** BW curve with embedding degree 13. */
 	BW13_P310,
+	/** BW curve with embedding degree 19. */
+	BW19_P286,
 };
 
 /**
@@ -163,6 +165,8 @@ enum {
 	EP_B12,
 	/* BW curves with embedding degree13. */
     EP_BW13,
+	/* BW curves with embedding degree 19. */
+	EP_BW19,
 	/* Fotiadis-Martindale with embedding degree 16. */
 	EP_FM16,
 	/* Kachisa-Schaefer-Scott with embedding degree 16. */
@@ -326,14 +330,14 @@ typedef iso_st *iso_t;
  * @param[out] A			- the new point.
  * @throw ERR_NO_MEMORY		- if there is no available memory.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define ep_new(A)															\
-	A = (ep_t)calloc(1, sizeof(ep_st));										\
+	A = (ep_t)RLC_CALLOC(1, sizeof(ep_st));									\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
 
-#elif ALLOC == AUTO
+#else
 #define ep_new(A)				/* empty */
 
 #endif
@@ -343,14 +347,14 @@ typedef iso_st *iso_t;
  *
  * @param[out] A			- the point to free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define ep_free(A)															\
 	if (A != NULL) {														\
-		free(A);															\
+		RLC_DEALLOC(A);														\
 		A = NULL;															\
 	}
 
-#elif ALLOC == AUTO
+#else
 #define ep_free(A)				/* empty */
 
 #endif
@@ -1003,6 +1007,25 @@ void ep_mul_gen(ep_t r, const bn_t k);
  */
 void ep_mul_dig(ep_t r, const ep_t p, dig_t k);
 
+/**
+ * Multiplies a prime elliptic curve point by the curve parameter, running its
+ * precomputed signed representation. The result is not normalized.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the point to multiply.
+ */
+void ep_mul_z(ep_t r, const ep_t p);
+
+/**
+ * Multiplies a prime elliptic point by the curve cofactor or a small multiple
+ * for which a short vector exists. In short, it takes a point in the curve to
+ * the large prime-order subgroup.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the point to multiply.
+ */
+void ep_mul_cof(ep_t r, const ep_t p);
+
 /**
  * Builds a precomputation table for multiplying a fixed prime elliptic point
  * using the binary method.
@@ -1253,6 +1276,23 @@ void ep_map(ep_t p, const uint8_t *msg, size_t len);
 void ep_map_dst(ep_t p, const uint8_t *msg, size_t len, const uint8_t *dst,
 		size_t dst_len);
 
+/**
+ * Maps several byte arrays to points in a prime elliptic curve with specified
+ * domain separation tag, giving the same results as ep_map_dst(). The field
+ * inversions of the maps and of the conversions to affine coordinates are
+ * shared among all messages.
+ *
+ * @param[out] p			- the results.
+ * @param[in] msgs			- the byte arrays to map.
+ * @param[in] lens			- the array lengths in bytes.
+ * @param[in] n				- the number of byte arrays.
+ * @param[in] dst			- the domain separation tag.
+ * @param[in] dst_len		- the domain separation tag length in bytes.
+ * @throw ERR_NO_MEMORY		- if there is no available memory.
+ */
+void ep_map_sim(ep_t *p, const uint8_t **msgs, const size_t *lens, int n,
+		const uint8_t *dst, size_t dst_len);
+
 /**
  * Compresses a point.
  *
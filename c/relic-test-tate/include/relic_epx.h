@@ -246,9 +246,9 @@ typedef ep13_st *ep13_t;
  * @param[out] A				- the new point.
  * @throw ERR_NO_MEMORY			- if there is no available memory.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define ep2_new(A)															\
-	A = (ep2_t)calloc(1, sizeof(ep2_st));									\
+	A = (ep2_t)RLC_CALLOC(1, sizeof(ep2_st));								\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
@@ -259,7 +259,7 @@ typedef ep13_st *ep13_t;
 	fp2_new((A)->y);														\
 	fp2_new((A)->z);														\
 
-#elif ALLOC == AUTO
+#else
 #define ep2_new(A)				/* empty */
 
 #endif
@@ -269,17 +269,17 @@ typedef ep13_st *ep13_t;
  *
  * @param[out] A				- the point to free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define ep2_free(A)															\
 	if (A != NULL) {														\
 		fp2_free((A)->x);													\
 		fp2_free((A)->y);													\
 		fp2_free((A)->z);													\
-		free(A);															\
+		RLC_DEALLOC(A);														\
 		A = NULL;															\
 	}																		\
 
-#elif ALLOC == AUTO
+#else
 #define ep2_free(A)				/* empty */
 #endif
 
@@ -296,9 +296,9 @@ typedef ep13_st *ep13_t;
  * @param[out] A				- the new point.
  * @throw ERR_NO_MEMORY			- if there is no available memory.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define ep3_new(A)															\
-	A = (ep3_t)calloc(1, sizeof(ep3_st));									\
+	A = (ep3_t)RLC_CALLOC(1, sizeof(ep3_st));								\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
@@ -309,7 +309,7 @@ typedef ep13_st *ep13_t;
 	fp3_new((A)->y);														\
 	fp3_new((A)->z);														\
 
-#elif ALLOC == AUTO
+#else
 #define ep3_new(A)				/* empty */
 
 #endif
@@ -319,17 +319,17 @@ typedef ep13_st *ep13_t;
  *
  * @param[out] A				- the point to free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define ep3_free(A)															\
 	if (A != NULL) {														\
 		fp3_free((A)->x);													\
 		fp3_free((A)->y);													\
 		fp3_free((A)->z);													\
-		free(A);															\
+		RLC_DEALLOC(A);														\
 		A = NULL;															\
 	}																		\
 
-#elif ALLOC == AUTO
+#else
 #define ep3_free(A)				/* empty */
 #endif
 
@@ -346,9 +346,9 @@ typedef ep13_st *ep13_t;
  * @param[out] A				- the new point.
  * @throw ERR_NO_MEMORY			- if there is no available memory.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define ep4_new(A)															\
-	A = (ep4_t)calloc(1, sizeof(ep4_st));									\
+	A = (ep4_t)RLC_CALLOC(1, sizeof(ep4_st));								\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
@@ -359,7 +359,7 @@ typedef ep13_st *ep13_t;
 	fp4_new((A)->y);														\
 	fp4_new((A)->z);														\
 
-#elif ALLOC == AUTO
+#else
 #define ep4_new(A)				/* empty */
 
 #endif
@@ -369,17 +369,17 @@ typedef ep13_st *ep13_t;
  *
  * @param[out] A				- the point to free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define ep4_free(A)															\
 	if (A != NULL) {														\
 		fp4_free((A)->x);													\
 		fp4_free((A)->y);													\
 		fp4_free((A)->z);													\
-		free(A);															\
+		RLC_DEALLOC(A);														\
 		A = NULL;															\
 	}																		\
 
-#elif ALLOC == AUTO
+#else
 #define ep4_free(A)				/* empty */
 #endif
 
@@ -740,11 +740,11 @@ typedef ep13_st *ep13_t;
  * @param[out] A				- the new point.
  * @throw ERR_NO_MEMORY			- if there is no available memory.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define ep13_new(A)															\
-	A = (ep13_t)calloc(1, sizeof(ep13_st));									\
+	A = (ep13_t)RLC_CALLOC(1, sizeof(ep13_st));								\
 	if (A == NULL) {														\
-		THROW(ERR_NO_MEMORY);												\
+		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
 	fp13_null((A)->x);														\
 	fp13_null((A)->y);														\
@@ -770,13 +770,13 @@ typedef ep13_st *ep13_t;
  *
  * @param[out] A				- the point to free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define ep13_free(A)															\
 	if (A != NULL) {														\
 		fp13_free((A)->x);													\
 		fp13_free((A)->y);													\
 		fp13_free((A)->z);													\
-		free(A);															\
+		RLC_DEALLOC(A);														\
 		A = NULL;															\
 	}																		\
 
@@ -888,11 +888,21 @@ typedef ep13_st *ep13_t;
 /**
  * Given a random point q of E, computes uq, where the seed u is used to parameterize the elliptic curves
  *
- * @param[out] r				- the result.
- * @param[in] q					- the  point to multiply.
- 
+ * @param[out] R				- the result.
+ * @param[in] Q					- the  point to multiply.
+ */
+#define ep13_rand_mul_u(R, Q)	ep13_mul_z(R, Q)
+
+/**
+ * Multiplies a point in an elliptic curve over a degree-13 extension by the
+ * curve parameter, running its precomputed signed representation. The result
+ * is not normalized.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the point to multiply.
  */
-void  ep13_rand_mul_u(ep13_t r, const ep13_t q);
+void ep13_mul_z(ep13_t r, const ep13_t p);
+
 /**
  * Given a random point q of E, hashing q to G2
  *
@@ -1296,6 +1306,16 @@ void ep2_mul_gen(ep2_t r, const bn_t k);
  */
 void ep2_mul_dig(ep2_t r, const ep2_t p, const dig_t k);
 
+/**
+ * Multiplies a point in an elliptic curve over a quadratic extension by the
+ * curve parameter, running its precomputed signed representation. The result
+ * is not normalized.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the point to multiply.
+ */
+void ep2_mul_z(ep2_t r, const ep2_t p);
+
 
 /**
  * Multiplies a point in an elliptic curve over a quadratic extension field by
@@ -2935,6 +2955,16 @@ int ep13_cmp(const ep13_t p, const ep13_t q);
  */
 void ep13_tab(ep13_t *t, const ep13_t p, int w);
 
+/**
+ * Initializes the elliptic curve over the 13-th extension field.
+ */
+void ep13_curve_init(void);
+
+/**
+ * Finalizes the elliptic curve over the 13-th extension field.
+ */
+void ep13_curve_clean(void);
+
 /**
  * Configures an elliptic curve.
  *
@@ -134,6 +134,8 @@ enum {
 	B12_455,
 	/** 310-bit prime for BW curve of embedding degree 13 . */
         BW13_310,
+	/** 286-bit prime for BW curve of embedding degree 19. */
+	BW19_286,
 	/** 477-bit prime for BLS curve of embedding degree 24. */
 	B24_509,
 	/** 508-bit prime for KSS16 curve. */
@@ -158,6 +160,30 @@ enum {
 	SS_3072,
 };
 
+/*
+ * Prime field operations tracked by the counters enabled with FP_COUNT.
+ */
+enum {
+	/** Multiplication with modular reduction. */
+	FP_OP_MUL,
+	/** Multiplication without modular reduction. */
+	FP_OP_MULN,
+	/** Squaring with modular reduction. */
+	FP_OP_SQR,
+	/** Squaring without modular reduction. */
+	FP_OP_SQRN,
+	/** Addition, subtraction, doubling, halving or negation. */
+	FP_OP_ADD,
+	/** Addition or subtraction of double-precision values. */
+	FP_OP_ADDD,
+	/** Modular reduction of a double-precision value. */
+	FP_OP_RDC,
+	/** Inversion. */
+	FP_OP_INV,
+	/** Number of tracked operations. */
+	FP_OPS
+};
+
 /**
  * Constant used to indicate that there's some room left in the storage of
  * prime field elements. This can be used to avoid carries.
@@ -214,9 +240,9 @@ typedef rlc_align dig_t fp_st[RLC_FP_DIGS + RLC_PAD(RLC_FP_BYTES)/(RLC_DIG / 8)]
  *
  * @param[out] A			- the new prime field element.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define fp_new(A)			dv_new_dynam((dv_t *)&(A), RLC_FP_DIGS)
-#elif ALLOC == AUTO
+#else
 #define fp_new(A)			/* empty */
 #endif
 
@@ -225,9 +251,9 @@ typedef rlc_align dig_t fp_st[RLC_FP_DIGS + RLC_PAD(RLC_FP_BYTES)/(RLC_DIG / 8)]
  *
  * @param[out] A			- the prime field element to clean and free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define fp_free(A)			dv_free_dynam((dv_t *)&(A))
-#elif ALLOC == AUTO
+#else
 #define fp_free(A)			/* empty */
 #endif
 
@@ -396,6 +422,31 @@ typedef rlc_align dig_t fp_st[RLC_FP_DIGS + RLC_PAD(RLC_FP_BYTES)/(RLC_DIG / 8)]
 #define fp_smb(A)		fp_smb_lower(A)
 #endif
 
+/*
+ * Route the prime field operations through the counting wrappers. The files
+ * implementing the wrappers define FP_NO_COUNT to reach the chosen methods.
+ */
+#if defined(FP_COUNT) && !defined(FP_NO_COUNT)
+#undef fp_add
+#define fp_add(C, A, B)		fp_add_cnt(C, A, B)
+#undef fp_sub
+#define fp_sub(C, A, B)		fp_sub_cnt(C, A, B)
+#undef fp_neg
+#define fp_neg(C, A)		fp_neg_cnt(C, A)
+#undef fp_dbl
+#define fp_dbl(C, A)		fp_dbl_cnt(C, A)
+#undef fp_hlv
+#define fp_hlv(C, A)		fp_hlv_cnt(C, A)
+#undef fp_mul
+#define fp_mul(C, A, B)		fp_mul_cnt(C, A, B)
+#undef fp_sqr
+#define fp_sqr(C, A)		fp_sqr_cnt(C, A)
+#undef fp_rdc
+#define fp_rdc(C, A)		fp_rdc_cnt(C, A)
+#undef fp_inv
+#define fp_inv(C, A)		fp_inv_cnt(C, A)
+#endif
+
 /**
  * Exponentiates a prime field element. Computes C = A^B (mod p).
  *
@@ -1177,5 +1228,60 @@ void fp_exp_monty(fp_t c, const fp_t a, const bn_t b);
  * @return					- 1 if there is a square root, 0 otherwise.
  */
 int fp_srt(fp_t c, const fp_t a);
-void fp_exp_z(fp_t a, const fp_t b);
+
+/**
+ * Exponentiates a prime field element by the absolute value of the curve
+ * parameter, using the addition chain generated for the current prime.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the prime field element to exponentiate.
+ */
+void fp_exp_z(fp_t c, const fp_t a);
+
+/**
+ * Resets the prime field operation counters of the current thread.
+ */
+void fp_count_reset(void);
+
+/**
+ * Reads the prime field operation counters of the current thread. The
+ * counters are always zero when FP_COUNT is disabled.
+ *
+ * @param[out] c			- the FP_OPS counters, indexed by FP_OP_*.
+ */
+void fp_count_get(ull_t *c);
+
+/**
+ * Wrappers that update the operation counters enabled by FP_COUNT. Each one
+ * has the same interface as the wrapped function.
+ * @{
+ */
+/** Counting wrapper for fp_add(). */
+void fp_add_cnt(fp_t c, const fp_t a, const fp_t b);
+
+/** Counting wrapper for fp_sub(). */
+void fp_sub_cnt(fp_t c, const fp_t a, const fp_t b);
+
+/** Counting wrapper for fp_neg(). */
+void fp_neg_cnt(fp_t c, const fp_t a);
+
+/** Counting wrapper for fp_dbl(). */
+void fp_dbl_cnt(fp_t c, const fp_t a);
+
+/** Counting wrapper for fp_hlv(). */
+void fp_hlv_cnt(fp_t c, const fp_t a);
+
+/** Counting wrapper for fp_mul(). */
+void fp_mul_cnt(fp_t c, const fp_t a, const fp_t b);
+
+/** Counting wrapper for fp_sqr(). */
+void fp_sqr_cnt(fp_t c, const fp_t a);
+
+/** Counting wrapper for fp_rdc(). */
+void fp_rdc_cnt(fp_t c, dv_t a);
+
+/** Counting wrapper for fp_inv(). */
+void fp_inv_cnt(fp_t c, const fp_t a);
+/** @} */
+
 #endif /* !RLC_FP_H */
@@ -46,6 +46,8 @@
 
 #undef first_ctx
 #define first_ctx     RLC_PREFIX(first_ctx)
+#undef first_thr
+#define first_thr     RLC_PREFIX(first_thr)
 #undef core_ctx
 #define core_ctx      RLC_PREFIX(core_ctx)
 
@@ -54,12 +56,38 @@
 #undef core_get
 #undef core_set
 #undef core_set_thread_initializer
+#undef core_thr
+#undef core_attach
+#undef core_size_bin
+#undef core_write_bin
+#undef core_read_bin
 
 #define core_init 	RLC_PREFIX(core_init)
 #define core_clean 	RLC_PREFIX(core_clean)
 #define core_get 	RLC_PREFIX(core_get)
 #define core_set 	RLC_PREFIX(core_set)
 #define core_set_thread_initializer 	RLC_PREFIX(core_set_thread_initializer)
+#define core_thr 	RLC_PREFIX(core_thr)
+#define core_attach 	RLC_PREFIX(core_attach)
+#define core_size_bin 	RLC_PREFIX(core_size_bin)
+#define core_write_bin 	RLC_PREFIX(core_write_bin)
+#define core_read_bin 	RLC_PREFIX(core_read_bin)
+
+#undef arena_malloc
+#undef arena_calloc
+#undef arena_realloc
+#undef arena_free
+#undef arena_mark
+#undef arena_release
+#undef arena_clean
+
+#define arena_malloc 	RLC_PREFIX(arena_malloc)
+#define arena_calloc 	RLC_PREFIX(arena_calloc)
+#define arena_realloc 	RLC_PREFIX(arena_realloc)
+#define arena_free 	RLC_PREFIX(arena_free)
+#define arena_mark 	RLC_PREFIX(arena_mark)
+#define arena_release 	RLC_PREFIX(arena_release)
+#define arena_clean 	RLC_PREFIX(arena_clean)
 
 #undef arch_init
 #undef arch_clean
@@ -82,6 +110,15 @@
 #undef bench_compute
 #undef bench_print
 #undef bench_total
+#undef bench_args
+#undef bench_label
+#undef bench_sample
+#undef bench_dist
+#undef bench_par
+#undef bench_count_before
+#undef bench_count_after
+#undef bench_count
+#undef bench_count_print
 
 #define bench_init 	RLC_PREFIX(bench_init)
 #define bench_clean 	RLC_PREFIX(bench_clean)
@@ -92,6 +129,15 @@
 #define bench_compute 	RLC_PREFIX(bench_compute)
 #define bench_print 	RLC_PREFIX(bench_print)
 #define bench_total 	RLC_PREFIX(bench_total)
+#define bench_args 	RLC_PREFIX(bench_args)
+#define bench_label 	RLC_PREFIX(bench_label)
+#define bench_sample 	RLC_PREFIX(bench_sample)
+#define bench_dist 	RLC_PREFIX(bench_dist)
+#define bench_par 	RLC_PREFIX(bench_par)
+#define bench_count_before 	RLC_PREFIX(bench_count_before)
+#define bench_count_after 	RLC_PREFIX(bench_count_after)
+#define bench_count 	RLC_PREFIX(bench_count)
+#define bench_count_print 	RLC_PREFIX(bench_count_print)
 
 #undef err_simple_msg
 #undef err_full_msg
@@ -958,6 +1004,7 @@
 #undef ep_mul_lwreg
 #undef ep_mul_gen
 #undef ep_mul_dig
+#undef ep_mul_cof
 #undef ep_mul_pre_basic
 #undef ep_mul_pre_yaowi
 #undef ep_mul_pre_nafwi
@@ -1052,6 +1099,7 @@
 #define ep_mul_lwreg 	RLC_PREFIX(ep_mul_lwreg)
 #define ep_mul_gen 	RLC_PREFIX(ep_mul_gen)
 #define ep_mul_dig 	RLC_PREFIX(ep_mul_dig)
+#define ep_mul_cof 	RLC_PREFIX(ep_mul_cof)
 #define ep_mul_pre_basic 	RLC_PREFIX(ep_mul_pre_basic)
 #define ep_mul_pre_yaowi 	RLC_PREFIX(ep_mul_pre_yaowi)
 #define ep_mul_pre_nafwi 	RLC_PREFIX(ep_mul_pre_nafwi)
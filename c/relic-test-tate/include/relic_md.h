@@ -123,6 +123,29 @@ enum {
 #define md_xmd(B, BL, I, IL, D, DL) 	md_xmd_sh512(B, BL, I, IL, D, DL)
 #endif
 
+/**
+ * Maps many byte vectors and a common domain separation tag to arbitrary-length
+ * pseudorandom outputs using the chosen hash function, hashing several
+ * messages in parallel when supported.
+ *
+ * @param[out] B					- the output buffer, with BL bytes per message.
+ * @param[in] BL					- the requested size of each output.
+ * @param[in] I						- the messages to hash.
+ * @param[in] IL					- the message lengths in bytes.
+ * @param[in] N						- the number of messages.
+ * @param[in] D						- the domain separation tag.
+ * @param[in] DL					- the domain separation tag length in bytes.
+ */
+#if MD_MAP == SH256
+#define md_xmd_sim(B, BL, I, IL, N, D, DL)								\
+	md_xmd_sh256_sim(B, BL, I, IL, N, D, DL)
+#else
+#define md_xmd_sim(B, BL, I, IL, N, D, DL)								\
+	for (int _i = 0; _i < (N); _i++) {									\
+		md_xmd((B) + _i * (BL), BL, (I)[_i], (IL)[_i], D, DL);			\
+	}
+#endif
+
 /*============================================================================*/
 /* Function prototypes                                                        */
 /*============================================================================*/
@@ -145,6 +168,17 @@ void md_map_sh224(uint8_t *hash, const uint8_t *msg, size_t len);
  */
 void md_map_sh256(uint8_t *hash, const uint8_t *msg, size_t len);
 
+/**
+ * Computes the SHA-256 hash function of many messages in parallel.
+ *
+ * @param[out] hash				- the digests, 32 bytes per message.
+ * @param[in] msg				- the messages to hash.
+ * @param[in] len				- the message lengths in bytes.
+ * @param[in] n					- the number of messages.
+ */
+void md_map_sh256_sim(uint8_t *hash, const uint8_t **msg, const size_t *len,
+		int n);
+
 /**
  * Computes the SHA-384 hash function.
  *
@@ -243,6 +277,21 @@ void md_xmd_sh224(uint8_t *buf, size_t buf_len, const uint8_t *in,
 void md_xmd_sh256(uint8_t *buf, size_t buf_len, const uint8_t *in,
 		size_t in_len, const uint8_t *dst, size_t dst_len);
 
+/**
+ * Map many byte vectors and a common domain separation tag to arbitrary-length
+ * pseudorandom outputs using the SHA-256 hash function in parallel.
+ *
+ * @param[out] buf					- the output buffer, buf_len bytes per message.
+ * @param[in] buf_len				- the requested size of each output.
+ * @param[in] in					- the messages to hash.
+ * @param[in] in_len				- the message lengths in bytes.
+ * @param[in] n						- the number of messages.
+ * @param[in] dst					- the domain separation tag.
+ * @param[in] dst_len				- the domain separation tag length in bytes.
+ */
+void md_xmd_sh256_sim(uint8_t *buf, size_t buf_len, const uint8_t **in,
+		const size_t *in_len, int n, const uint8_t *dst, size_t dst_len);
+
 /**
  * Map a byte vector and optional domain separation tag to an arbitrary-length
  * pseudorandom output using the SHA-384 hash function.
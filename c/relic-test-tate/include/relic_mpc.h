@@ -116,9 +116,9 @@ typedef pt_st *pt_t;
  * @param[in,out] A			- the multiple precision integer to initialize.
  * @throw ERR_NO_MEMORY		- if there is no available memory.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define mt_new(A)															\
-	A = (mt_t)calloc(1, sizeof(mt_st));										\
+	A = (mt_t)RLC_CALLOC(1, sizeof(mt_st));									\
 	if ((A) == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
@@ -129,7 +129,7 @@ typedef pt_st *pt_t;
 	bn_new((A)->b);															\
 	bn_new((A)->c);															\
 
-#elif ALLOC == AUTO
+#else
 #define mt_new(A)															\
 	bn_new((A)->a);															\
 	bn_new((A)->b);															\
@@ -142,17 +142,17 @@ typedef pt_st *pt_t;
  *
  * @param[in,out] A			- the multiple precision integer to free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define mt_free(A)															\
 	if (A != NULL) {														\
 		bn_free((A)->a);													\
 		bn_free((A)->b);													\
 		bn_free((A)->c);													\
-		free(A);															\
+		RLC_DEALLOC(A);														\
 		A = NULL;															\
 	}
 
-#elif ALLOC == AUTO
+#else
 #define mt_free(A)			/* empty */										\
 
 #endif
@@ -173,9 +173,9 @@ typedef pt_st *pt_t;
  *
  * @param[out] A			- the new pairing triple.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define pt_new(A)															\
-	A = (pt_t)calloc(1, sizeof(pt_st));										\
+	A = (pt_t)RLC_CALLOC(1, sizeof(pt_st));									\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
@@ -183,7 +183,7 @@ typedef pt_st *pt_t;
 	g2_new((A)->b);															\
 	gt_new((A)->c);															\
 
-#elif ALLOC == AUTO
+#else
 #define pt_new(A)				/* empty */
 
 #endif
@@ -193,17 +193,17 @@ typedef pt_st *pt_t;
  *
  * @param[out] A			- the pairing triple to clean and free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define pt_free(A)															\
 	if (A != NULL) {														\
 		g1_free((A)->a);													\
 		g2_free((A)->b);													\
 		gt_free((A)->c);													\
-		free(A);															\
+		RLC_DEALLOC(A);														\
 		A = NULL;															\
 	}
 
-#elif ALLOC == AUTO
+#else
 #define pt_free(A)				/* empty */
 
 #endif
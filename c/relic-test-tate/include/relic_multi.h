@@ -69,9 +69,9 @@
  */
 #if MULTI == OPENMP
 /**
- * Active library context, only visible inside the library.
+ * State of the current thread, only visible inside the library.
  */
-extern rlc_thread ctx_t first_ctx;
+extern rlc_thread thr_t first_thr;
 
 /**
  * Pointer to active library context, only visible inside the library.
@@ -79,7 +79,7 @@ extern rlc_thread ctx_t first_ctx;
 extern rlc_thread ctx_t *core_ctx;
 
 #if !defined(_MSC_VER)
-#pragma omp threadprivate(first_ctx, core_ctx)
+#pragma omp threadprivate(first_thr, core_ctx)
 #endif
 #endif
 
@@ -103,6 +103,18 @@
  */
 #define RLC_G2_TABLE			RLC_CAT(RLC_CAT(RLC_, RLC_G2_UPPER), _TABLE)
 
+/**
+ * Bit length of the random exponents used to combine Miller values in the
+ * batched Tate-based membership test.
+ */
+#define RLC_TATE_BATCH			64
+
+/**
+ * Number of consecutive elements assigned at once to a thread when
+ * validating elements in bulk.
+ */
+#define RLC_PC_CHUNK			16
+
 /*============================================================================*/
 /* Type definitions                                                           */
 /*============================================================================*/
@@ -132,6 +144,41 @@ typedef RLC_CAT(RLC_G2_LOWER, st) g2_st;
  */
 typedef RLC_CAT(RLC_GT_LOWER, t) gt_t;
 
+/**
+ * Represents a precomputed Miller table for the Tate-based membership test.
+ */
+typedef struct {
+	/** The line coefficients and intermediate points. */
+	fp_t *tab;
+	/** The number of entries, derived from the NAF of the loop parameter. */
+	int len;
+} tate_tab_st;
+
+/**
+ * Pointer to a precomputed Miller table.
+ */
+typedef tate_tab_st tate_tab_t[1];
+
+/**
+ * Steps of the Miller loop schedule of the Tate-based membership test.
+ */
+enum {
+	/** Quadrupling step, consuming two zero digits. */
+	TATE_SQPL,
+	/** Addition step following a quadrupling. */
+	TATE_SADD,
+	/** Subtraction step following a quadrupling. */
+	TATE_SSUB,
+	/** Doubling-and-addition step. */
+	TATE_SDADD,
+	/** Doubling-and-subtraction step. */
+	TATE_SDSUB,
+	/** Doubling step. */
+	TATE_SDBL,
+	/** Final step for a negative lowest digit. */
+	TATE_SDSUBL
+};
+
 /*============================================================================*/
 /* Macro definitions                                                          */
 /*============================================================================*/
@@ -143,6 +190,13 @@ typedef RLC_CAT(RLC_GT_LOWER, t) gt_t;
  */
 #define g1_null(A)			RLC_CAT(RLC_G1_LOWER, null)(A)
 
+/**
+ * Initializes a precomputed Miller table with a null value.
+ *
+ * @param[out] T			- the table to initialize.
+ */
+#define tate_tab_null(T)	(T)->tab = NULL; (T)->len = 0;
+
 /**
  * Initializes a G_2 element with a null value.
  *
@@ -692,6 +746,24 @@ typedef RLC_CAT(RLC_GT_LOWER, t) gt_t;
  */
 #define g2_mul_any(R, P, K)		RLC_CAT(RLC_G2_LOWER, mul_basic)(R, P, K)
 
+/**
+ * Multiplies an element from a larger group containing G_1 by the cofactor,
+ * mapping it to G_1. Computes R = [h]P.
+ *
+ * @param[out] R				- the result.
+ * @param[in] P					- the element to multiply.
+ */
+#define g1_mul_cof(R, P)		RLC_CAT(RLC_G1_LOWER, mul_cof)(R, P)
+
+/**
+ * Multiplies an element from a larger group containing G_2 by the cofactor,
+ * mapping it to G_2. Computes R = [h]P.
+ *
+ * @param[out] R				- the result.
+ * @param[in] P					- the element to multiply.
+ */
+#define g2_mul_cof(R, P)		RLC_CAT(RLC_G2_LOWER, mul_cof)(R, P)
+
 /**
  * Multiplies an element from G_1 by a small integer. Computes R = [k]P.
  *
@@ -1048,6 +1120,15 @@ void gt_get_gen(gt_t g);
  */
 int g1_is_valid(const g1_t a);
 
+/**
+ * Checks if an element from G_1 is valid with the endomorphism-based formulas,
+ * falling back to an explicit order check on curves without them or when the
+ * library is built with PC_METHD=ORDER. Never uses the Tate-based test.
+ *
+ * @param[in] a             - the element to check.
+ */
+int g1_is_valid_endom(const g1_t a);
+
 /**
  * Checks if an element form G_2 is valid (has the right order).
  *
@@ -1071,7 +1152,39 @@ int gt_is_valid_bn(gt_t a);
 int g1_is_valid_bw13(ep_t a);
 int g2_is_valid_bw13(ep13_t a);
 int gt_is_valid_bw13(fp13_t a);
-void g1_tate_gen(g1_t g);
+
+/**
+ * Returns the auxiliary point for the Tate-based membership test in G_1 on
+ * the current curve, using a recorded point if there is one and searching
+ * with g1_tate_find() otherwise.
+ *
+ * @param[out] g			- the auxiliary point.
+ * @return 1 if the curve supports the Tate test, 0 otherwise.
+ */
+int g1_tate_gen(g1_t g);
+
+/**
+ * Derives an auxiliary point for the Tate-based membership test in G_1 by a
+ * deterministic search. The point Q has order e = tate_ord() in E(F_p) and
+ * the Weil pairing of Q and psi(Q) has order e/3, so that the two Tate
+ * pairings with Q are nondegenerate on the cofactor part of E(F_p). The point
+ * at infinity is returned for curves of prime order.
+ *
+ * @param[out] g			- the auxiliary point.
+ * @return 1 if a point was found, 0 otherwise.
+ */
+int g1_tate_find(g1_t g);
+
+/**
+ * Computes the order of the auxiliary point of the Tate-based membership test
+ * on the current curve: |z - 1| for BLS curves and z^2 - z + 1 for BW13
+ * and BW19 curves, where z is the curve parameter, and 1 for BN curves.
+ *
+ * @param[out] e			- the order.
+ * @return 1 if the curve is supported, 0 otherwise.
+ */
+int tate_ord(bn_t e);
+
 int g1_is_valid_tate(g1_t a, g1_t q);
 int test_tate(g1_t p, g1_t q);
 void tate_exp1(fp_t a, fp_t c, fp_t b);
@@ -1079,12 +1192,186 @@ void tate_exp2(fp_t a, fp_t b);
 void tate_qpl(fp_t f1, fp_t g1, fp_t f2, fp_t g2, g1_t q, g1_t p, g1_t p2);
 void tate_dba(fp_t f1, fp_t g1, fp_t f2, fp_t g2,  g1_t r, g1_t q, g1_t p, g1_t p2);
 void tate_add(fp_t f1, fp_t g1, fp_t f2, fp_t g2, g1_t r, g1_t q, g1_t p, g1_t p2);
-void tate_sub(fp_t f1, fp_t g1, fp_t f2, fp_t g2, g1_t r, g1_t q, g1_t p, g1_t p2);
+void tate_sub(fp_t f1, fp_t g1, fp_t f2, fp_t g2, g1_t r, g1_t q, g1_t p, g1_t p2,
+		const fp_t d1, const fp_t d2, const fp_t d3);
 void tate_dbl(fp_t f1, fp_t g1, fp_t f2, fp_t g2, g1_t q, g1_t p, g1_t p2);
-void tate_dbs(fp_t f1, fp_t g1, fp_t f2, fp_t g2,  g1_t r, g1_t q, g1_t p, g1_t p2);
+void tate_dbs(fp_t f1, fp_t g1, fp_t f2, fp_t g2,  g1_t r, g1_t q, g1_t p, g1_t p2,
+		const fp_t d1, const fp_t d2);
 void tate_miller(fp_t N1, fp_t D1, fp_t N2, fp_t D2, g1_t q, g1_t p, g1_t p2);
 void miller_tab(fp_t *tab, g1_t q);
 void tate_miller_pre(fp_t *tab, fp_t N1, fp_t D1, fp_t N2, fp_t D2, g1_t q, g1_t p, g1_t p2);
 int test_tate_pre(g1_t p, g1_t q, fp_t *tab);
 int g1_is_valid_tate_pre(g1_t a, g1_t q, fp_t* tab);
+
+/**
+ * Recodes the Miller loop parameter of the Tate-based membership test on the
+ * current curve into a sequence of steps.
+ *
+ * @param[out] op			- the steps, with room for RLC_FP_BITS + 1 entries.
+ * @return the number of steps, or 0 if the curve is not supported.
+ */
+int tate_sched(uint8_t *op);
+
+/**
+ * Prepares the vectorized Miller loop of the Tate-based membership test for
+ * the current curve, if the processor supports it.
+ *
+ * @return 1 if the vectorized Miller loop is used, 0 otherwise.
+ */
+int tate_vec_calc(void);
+
+/**
+ * Computes the precomputed Miller loop of the Tate-based membership test with
+ * the four Miller values processed in parallel by vector instructions. Falls
+ * back to tate_miller_pre() if no vector unit is available.
+ *
+ * @param[in] tab			- the precomputed Miller table.
+ * @param[in,out] N1		- the numerator of the first Miller value.
+ * @param[in,out] D1		- the denominator of the first Miller value.
+ * @param[in,out] N2		- the numerator of the second Miller value.
+ * @param[in,out] D2		- the denominator of the second Miller value.
+ * @param[in] q				- the auxiliary point.
+ * @param[in] p				- the point to test.
+ * @param[in] p2			- the image of the point by the endomorphism.
+ */
+void tate_miller_vec(fp_t *tab, fp_t N1, fp_t D1, fp_t N2, fp_t D2, g1_t q,
+		g1_t p, g1_t p2);
+
+/**
+ * Returns the number of entries of the Miller table for the Tate-based
+ * membership test on the current curve.
+ *
+ * @return the number of entries, or 0 if the curve is not supported.
+ */
+int tate_tab_len(void);
+
+/**
+ * Allocates and fills a Miller table for an auxiliary point.
+ *
+ * @param[out] t			- the table to build.
+ * @param[in] q				- the auxiliary point.
+ * @throw ERR_NO_MEMORY		- if there is not enough memory.
+ * @throw ERR_NO_VALID		- if the curve is not supported.
+ */
+void tate_tab_make(tate_tab_t t, g1_t q);
+
+/**
+ * Frees a Miller table.
+ *
+ * @param[out] t			- the table to free.
+ */
+void tate_tab_free(tate_tab_t t);
+
+/**
+ * Returns the auxiliary point for the Tate-based membership test computed
+ * when the curve was configured.
+ *
+ * @param[out] q			- the auxiliary point.
+ */
+void g1_tate_get(g1_t q);
+
+/**
+ * Returns the Miller table for the auxiliary point computed when the curve
+ * was configured.
+ *
+ * @return the table, or NULL if the Tate test is not available.
+ */
+const tate_tab_st *g1_tate_get_tab(void);
+
+/**
+ * Checks if an element from G_1 is valid using the precomputed Tate test with
+ * the auxiliary point and Miller table stored in the library context.
+ *
+ * @param[in] a				- the element to check.
+ * @return 1 if the element is valid, 0 otherwise.
+ */
+int g1_is_valid_tate_ctx(g1_t a);
+
+/**
+ * Checks if a batch of elements from G_1 is valid using the Tate-based
+ * membership test. The Miller values of all points are combined with random
+ * exponents so the batch shares a single inversion and a single final
+ * exponentiation for each Tate pairing. On failure, the batch is bisected to
+ * locate the invalid elements. A batch containing an invalid element passes
+ * with probability at most 1/l, where l is the smallest prime factor of the
+ * order of the pairing values, so curves with small factors in the pairing
+ * orders (BLS12-381 has 3 and 11) should only use this as a fast filter.
+ *
+ * @param[out] res			- the validity flag of each element.
+ * @param[in] a				- the elements to check.
+ * @param[in] n				- the number of elements.
+ * @param[in] q				- the auxiliary point.
+ * @return 1 if all elements are valid, 0 otherwise.
+ */
+int g1_is_valid_tate_batch(int *res, const g1_t *a, int n, g1_t q);
+
+/**
+ * Checks if a lot of elements from G_1 is valid using the precomputed Tate
+ * test, distributing chunks of elements among threads when the library is
+ * built with multithreading support. The auxiliary point and the Miller table
+ * stored in the library context are only read, so they are shared by all
+ * threads.
+ *
+ * @param[out] res			- the validity flag of each element.
+ * @param[in] a				- the elements to check.
+ * @param[in] n				- the number of elements.
+ * @param[in] t				- the number of threads, or 0 to use CORES.
+ * @return 1 if all elements are valid, 0 otherwise.
+ */
+int g1_is_valid_tate_lot(int *res, const g1_t *a, int n, int t);
+
+/**
+ * Reads an element of G_1 from a byte vector and checks that it is valid,
+ * fusing the decompression and the on-curve check with the precomputed Tate
+ * test whenever the library context holds a Miller table, and falling back to
+ * g1_is_valid() otherwise. Encodings are the same as in
+ * g1_read_bin(). Malformed encodings are rejected without raising an error,
+ * and the point at infinity is rejected as in g1_is_valid().
+ *
+ * @param[out] a			- the result, or the point at infinity if invalid.
+ * @param[in] bin			- the byte vector.
+ * @param[in] len			- the buffer capacity.
+ * @return 1 if the element is valid, 0 otherwise.
+ */
+int g1_read_bin_valid(g1_t a, const uint8_t *bin, size_t len);
+
+/**
+ * Reads a set of elements of G_1 from byte vectors and checks that they are
+ * valid as in g1_read_bin_valid(). The exponents of the square roots are
+ * computed once and the Miller values of all points share a single
+ * inversion, while each point still gets its own final exponentiation.
+ *
+ * @param[out] out			- the results, the point at infinity if invalid.
+ * @param[out] ok			- the validity flag of each element.
+ * @param[in] in			- the byte vectors.
+ * @param[in] len			- the capacity of each buffer.
+ * @param[in] n				- the number of elements.
+ * @return 1 if all elements are valid, 0 otherwise.
+ */
+int g1_read_bin_valid_sim(g1_t *out, int *ok, const uint8_t **in,
+		const size_t *len, int n);
+
+/**
+ * Checks if a lot of elements from G_2 on a BW13 curve is valid, distributing
+ * chunks of elements among threads.
+ *
+ * @param[out] res			- the validity flag of each element.
+ * @param[in] a				- the elements to check.
+ * @param[in] n				- the number of elements.
+ * @param[in] t				- the number of threads, or 0 to use CORES.
+ * @return 1 if all elements are valid, 0 otherwise.
+ */
+int g2_is_valid_bw13_lot(int *res, const ep13_t *a, int n, int t);
+
+/**
+ * Checks if a lot of elements from G_T on a BW13 curve is valid, distributing
+ * chunks of elements among threads.
+ *
+ * @param[out] res			- the validity flag of each element.
+ * @param[in] a				- the elements to check.
+ * @param[in] n				- the number of elements.
+ * @param[in] t				- the number of threads, or 0 to use CORES.
+ * @return 1 if all elements are valid, 0 otherwise.
+ */
+int gt_is_valid_bw13_lot(int *res, const fp13_t *a, int n, int t);
 #endif /* !RLC_PC_H */
@@ -80,18 +80,18 @@ ull_t arch_cycles(void) {
 ull_t arch_cycles(void) {
 	uint_t seq;
 	ull_t index, offset, result = 0;
-	if (core_get()->perf_buf != NULL) {
+	if (core_thr()->perf_buf != NULL) {
 		do {
-			seq = core_get()->perf_buf->lock;
+			seq = core_thr()->perf_buf->lock;
 			asm("" ::: "memory");
-			index = core_get()->perf_buf->index;
-			offset = core_get()->perf_buf->offset;
+			index = core_thr()->perf_buf->index;
+			offset = core_thr()->perf_buf->offset;
 			asm(
 				"rdpmc; shlq $32, %%rdx; orq %%rdx,%%rax"
 				: "=a" (result) : "c" (index - 1) : "%rdx"
 			);
 			asm("" ::: "memory");
-		} while (core_get()->perf_buf->lock != seq);
+		} while (core_thr()->perf_buf->lock != seq);
 
 		result += offset;
 		result &= RLC_MASK(48); /* Get lower 48 bits only. */
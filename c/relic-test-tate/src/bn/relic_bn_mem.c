@@ -48,7 +48,7 @@ void bn_make(bn_t a, size_t digits) {
 	/* Allocate at least one digit. */
 	digits = RLC_MAX(digits, 1);
 
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 	if (digits % RLC_BN_SIZE != 0) {
 		/* Pad the number of digits to a multiple of the block. */
 		digits += (RLC_BN_SIZE - digits % RLC_BN_SIZE);
@@ -56,7 +56,9 @@ void bn_make(bn_t a, size_t digits) {
 
 	if (a != NULL) {
 		a->dp = NULL;
-#if ALIGN == 1
+#if ALLOC == ARENA
+		a->dp = (dig_t *)arena_malloc(digits * sizeof(dig_t));
+#elif ALIGN == 1
 		a->dp = (dig_t *)malloc(digits * sizeof(dig_t));
 #elif OPSYS == WINDOWS
 		a->dp = _aligned_malloc(digits * sizeof(dig_t), ALIGN);
@@ -72,7 +74,7 @@ void bn_make(bn_t a, size_t digits) {
 	}
 
 	if (a->dp == NULL) {
-		free((void *)a);
+		RLC_DEALLOC(a);
 		RLC_THROW(ERR_NO_MEMORY);
 	}
 #else
@@ -93,10 +95,12 @@ void bn_make(bn_t a, size_t digits) {
 }
 
 void bn_clean(bn_t a) {
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 	if (a != NULL) {
 		if (a->dp != NULL) {
-#if OPSYS == WINDOWS && ALIGN > 1
+#if ALLOC == ARENA
+			arena_free(a->dp);
+#elif OPSYS == WINDOWS && ALIGN > 1
 			_aligned_free(a->dp);
 #else
 			free(a->dp);
@@ -113,13 +117,13 @@ void bn_clean(bn_t a) {
 }
 
 void bn_grow(bn_t a, size_t digits) {
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 	dig_t *t;
 
 	if (a->alloc < digits) {
 		/* At least add RLC_BN_SIZE more digits. */
 		digits += (RLC_BN_SIZE * 2) - (digits % RLC_BN_SIZE);
-		t = (dig_t *)realloc(a->dp, (RLC_DIG / 8) * digits);
+		t = (dig_t *)RLC_REALLOC(a->dp, (RLC_DIG / 8) * digits);
 		if (t == NULL) {
 			RLC_THROW(ERR_NO_MEMORY);
 			return;
@@ -128,7 +132,7 @@ void bn_grow(bn_t a, size_t digits) {
 		/* Set the newly allocated digits to zero. */
 		a->alloc = digits;
 	}
-#elif ALLOC == AUTO
+#else
 	if (digits > RLC_BN_SIZE) {
 		RLC_THROW(ERR_NO_PRECI);
 		return;
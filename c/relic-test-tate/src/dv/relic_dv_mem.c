@@ -45,14 +45,16 @@
 /* Public definitions                                                         */
 /*============================================================================*/
 
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 
 void dv_new_dynam(dv_t *a, size_t digits) {
 	if (digits > RLC_DV_DIGS) {
 		RLC_THROW(ERR_NO_PRECI);
 		return;
 	}
-#if ALIGN == 1
+#if ALLOC == ARENA
+	*a = arena_malloc(digits * (RLC_DIG / 8));
+#elif ALIGN == 1
 	*a = malloc(digits * (RLC_DIG / 8));
 #elif OPSYS == WINDOWS
 	*a = _aligned_malloc(digits * (RLC_DIG / 8), ALIGN);
@@ -73,7 +75,9 @@ void dv_new_dynam(dv_t *a, size_t digits) {
 
 void dv_free_dynam(dv_t *a) {
 	if ((*a) != NULL) {
-#if OPSYS == WINDOWS && ALIGN > 1
+#if ALLOC == ARENA
+		arena_free(*a);
+#elif OPSYS == WINDOWS && ALIGN > 1
 		_aligned_free(*a);
 #else
 		free(*a);
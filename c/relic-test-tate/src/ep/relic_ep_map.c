@@ -78,6 +78,259 @@ static inline int fp_sgn0(const fp_t t, bn_t k) {
 	return bn_get_bit(k, 0);
 }
 
+/**
+ * Applies the simplified SWU map to a vector of field elements, sharing the
+ * inversions among all of them. When p = 3 mod 4, the square root of g(x2) is
+ * derived from the exponentiation used for g(x1), so each element costs a
+ * single exponentiation.
+ *
+ * @param[out] p			- the resulting points.
+ * @param[in] t				- the field elements to map.
+ * @param[in] n				- the number of field elements.
+ */
+static void ep_map_sswu_sim(ep_t *p, const fp_t *t, int n) {
+	ctx_t *ctx = core_get();
+	dig_t *mBoverA = ctx->ep_map_c[0];
+	dig_t *a = ctx->ep_map_c[2];
+	dig_t *b = ctx->ep_map_c[3];
+	dig_t *u = ctx->ep_map_u;
+	int i, *e = RLC_ALLOCA(int, n);
+	fp_t c, t0, t1, *v = RLC_ALLOCA(fp_t, n), *d = RLC_ALLOCA(fp_t, n);
+	bn_t k;
+
+	bn_null(k);
+	fp_null(c);
+	fp_null(t0);
+	fp_null(t1);
+
+	RLC_TRY {
+		if (e == NULL || v == NULL || d == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < n; i++) {
+			fp_null(v[i]);
+			fp_null(d[i]);
+			fp_new(v[i]);
+			fp_new(d[i]);
+		}
+		bn_new(k);
+		fp_new(c);
+		fp_new(t0);
+		fp_new(t1);
+
+		/* Compute v = u * t^2 and the denominator u^2 * t^4 + u * t^2, or -u
+		 * in the exceptional case. */
+		for (i = 0; i < n; i++) {
+			fp_sqr(v[i], t[i]);
+			fp_mul(v[i], v[i], u);
+			fp_sqr(d[i], v[i]);
+			fp_add(d[i], d[i], v[i]);
+			e[i] = fp_is_zero(d[i]);
+			fp_neg(t0, u);
+			dv_copy_cond(d[i], t0, RLC_FP_DIGS, e[i]);
+		}
+		fp_inv_sim(d, (const fp_t *)d, n);
+
+		k->used = RLC_FP_DIGS;
+		dv_copy(k->dp, fp_prime_get(), RLC_FP_DIGS);
+		bn_trim(k);
+		if (fp_prime_get_mod8() == 3 || fp_prime_get_mod8() == 7) {
+			/* Since u is not a square, c^2 = -u^3 for c = (u^3)^((p + 1)/4). */
+			bn_add_dig(k, k, 1);
+			bn_rsh(k, k, 2);
+			fp_sqr(c, u);
+			fp_mul(c, c, u);
+			fp_exp(c, c, k);
+		} else {
+			bn_zero(k);
+		}
+
+		for (i = 0; i < n; i++) {
+			/* Compute x1 = -B/A * (1 + 1/(u^2 * t^4 + u * t^2)) and g(x1). */
+			fp_add_dig(t0, d[i], 1);
+			dv_copy_cond(d[i], t0, RLC_FP_DIGS, e[i] == 0);
+			fp_mul(p[i]->x, d[i], mBoverA);
+			fp_sqr(t0, p[i]->x);
+			fp_add(t0, t0, a);
+			fp_mul(t0, t0, p[i]->x);
+			fp_add(t0, t0, b);
+			if (!bn_is_zero(k)) {
+				fp_exp(p[i]->y, t0, k);
+				fp_sqr(t1, p[i]->y);
+				if (fp_cmp(t1, t0) != RLC_EQ) {
+					/* Then g(x2) = u^3 * t^6 * g(x1) has root t^3 * y * c. */
+					fp_mul(p[i]->x, p[i]->x, v[i]);
+					fp_mul(t0, v[i], v[i]);
+					fp_mul(t0, t0, v[i]);
+					fp_mul(t0, t0, t1);
+					fp_neg(t0, t0);
+					fp_sqr(t1, t[i]);
+					fp_mul(t1, t1, t[i]);
+					fp_mul(p[i]->y, p[i]->y, t1);
+					fp_mul(p[i]->y, p[i]->y, c);
+					fp_sqr(t1, p[i]->y);
+					if (fp_cmp(t1, t0) != RLC_EQ) {
+						RLC_THROW(ERR_NO_VALID);
+					}
+				}
+			} else if (!fp_srt(p[i]->y, t0)) {
+				fp_mul(p[i]->x, p[i]->x, v[i]);
+				fp_sqr(t1, v[i]);
+				fp_mul(t1, t1, v[i]);
+				fp_mul(t0, t0, t1);
+				if (!fp_srt(p[i]->y, t0)) {
+					RLC_THROW(ERR_NO_VALID);
+				}
+			}
+			fp_set_dig(p[i]->z, 1);
+			p[i]->coord = BASIC;
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; i < n; i++) {
+			fp_free(v[i]);
+			fp_free(d[i]);
+		}
+		bn_free(k);
+		fp_free(c);
+		fp_free(t0);
+		fp_free(t1);
+		RLC_FREE(e);
+		RLC_FREE(v);
+		RLC_FREE(d);
+	}
+}
+
+/**
+ * Applies the Shallue--van de Woestijne map to a vector of field elements,
+ * sharing the inversions among all of them.
+ *
+ * @param[out] p			- the resulting points.
+ * @param[in] t				- the field elements to map.
+ * @param[in] n				- the number of field elements.
+ */
+static void ep_map_svdw_sim(ep_t *p, const fp_t *t, int n) {
+	ctx_t *ctx = core_get();
+	dig_t *gU = ctx->ep_map_c[0];
+	dig_t *mUover2 = ctx->ep_map_c[1];
+	dig_t *c3 = ctx->ep_map_c[2];
+	dig_t *c4 = ctx->ep_map_c[3];
+	dig_t *u = ctx->ep_map_u;
+	int i, *e = RLC_ALLOCA(int, n);
+	fp_t t4, *v = RLC_ALLOCA(fp_t, n), *w = RLC_ALLOCA(fp_t, n);
+	fp_t *d = RLC_ALLOCA(fp_t, n);
+
+	fp_null(t4);
+
+	RLC_TRY {
+		if (e == NULL || v == NULL || w == NULL || d == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < n; i++) {
+			fp_null(v[i]);
+			fp_null(w[i]);
+			fp_null(d[i]);
+			fp_new(v[i]);
+			fp_new(w[i]);
+			fp_new(d[i]);
+		}
+		fp_new(t4);
+
+		/* Compute v = 1 - t^2 * g(u), w = 1 + t^2 * g(u) and d = v * w, or
+		 * g(u) in the exceptional case. */
+		for (i = 0; i < n; i++) {
+			fp_sqr(v[i], t[i]);
+			fp_mul(v[i], v[i], gU);
+			fp_add_dig(w[i], v[i], 1);
+			fp_sub_dig(v[i], v[i], 1);
+			fp_neg(v[i], v[i]);
+			fp_mul(d[i], v[i], w[i]);
+			e[i] = fp_is_zero(d[i]);
+			dv_copy_cond(d[i], gU, RLC_FP_DIGS, e[i]);
+		}
+		fp_inv_sim(d, (const fp_t *)d, n);
+
+		for (i = 0; i < n; i++) {
+			fp_zero(t4);
+			dv_copy_cond(d[i], t4, RLC_FP_DIGS, e[i]);
+			fp_mul(t4, t[i], v[i]);
+			fp_mul(t4, t4, d[i]);
+			fp_mul(t4, t4, c3);
+			/* Try x1, x2 and x3 in order. */
+			fp_sub(p[i]->x, mUover2, t4);
+			ep_rhs(p[i]->y, p[i]);
+			if (!fp_srt(p[i]->y, p[i]->y)) {
+				fp_add(p[i]->x, mUover2, t4);
+				ep_rhs(p[i]->y, p[i]);
+				if (!fp_srt(p[i]->y, p[i]->y)) {
+					fp_sqr(p[i]->x, w[i]);
+					fp_mul(p[i]->x, p[i]->x, d[i]);
+					fp_sqr(p[i]->x, p[i]->x);
+					fp_mul(p[i]->x, p[i]->x, c4);
+					fp_add(p[i]->x, p[i]->x, u);
+					ep_rhs(p[i]->y, p[i]);
+					if (!fp_srt(p[i]->y, p[i]->y)) {
+						RLC_THROW(ERR_NO_VALID);
+					}
+				}
+			}
+			fp_set_dig(p[i]->z, 1);
+			p[i]->coord = BASIC;
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; i < n; i++) {
+			fp_free(v[i]);
+			fp_free(w[i]);
+			fp_free(d[i]);
+		}
+		fp_free(t4);
+		RLC_FREE(e);
+		RLC_FREE(v);
+		RLC_FREE(w);
+		RLC_FREE(d);
+	}
+}
+
+/**
+ * Clears the cofactor of a point in affine coordinates without converting the
+ * result back to affine coordinates, so that a batch of results can share a
+ * single inversion. Follows the multipliers used by ep_mul_cof().
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the point in affine coordinates.
+ */
+static void ep_map_cof(ep_t r, const ep_t p) {
+	ep_t t;
+
+	if (ep_curve_is_pairf() != EP_B12 && ep_curve_is_pairf() != EP_B24) {
+		ep_mul_cof(r, p);
+		return;
+	}
+
+	ep_null(t);
+
+	RLC_TRY {
+		ep_new(t);
+
+		/* Multiply by 1 - x as in ep_mul_cof(). */
+		ep_mul_z(t, p);
+		ep_sub(r, p, t);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		ep_free(t);
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -148,32 +401,7 @@ void ep_map_from_field(ep_t p, const uint8_t *uniform_bytes, size_t len) {
 		ep_norm(p, p);
 
 		/* clear cofactor */
-		switch (ep_curve_is_pairf()) {
-			case EP_BN:
-				/* h = 1 */
-				break;
-			case EP_B12:
-			case EP_B24:
-				/* Multiply by (1-x) to get the correct group, as proven in
-				 * Piellard. https://eprint.iacr.org/2022/352.pdf */
-				fp_prime_get_par(k);
-				bn_neg(k, k);
-				bn_add_dig(k, k, 1);
-				if (bn_bits(k) < RLC_DIG) {
-					ep_mul_dig(p, p, k->dp[0]);
-				} else {
-					ep_mul(p, p, k);
-				}
-				break;
-			default:
-				/* multiply by cofactor to get the correct group. */
-				ep_curve_get_cof(k);
-				if (bn_bits(k) < RLC_DIG) {
-					ep_mul_dig(p, p, k->dp[0]);
-				} else {
-					ep_mul_basic(p, p, k);
-				}
-		}
+		ep_mul_cof(p, p);
 	}
 	RLC_CATCH_ANY {
 		RLC_THROW(ERR_CAUGHT);
@@ -211,3 +439,85 @@ void ep_map_dst(ep_t p, const uint8_t *msg, size_t len, const uint8_t *dst,
 void ep_map(ep_t p, const uint8_t *msg, size_t len) {
 	ep_map_dst(p, msg, len, (const uint8_t *)"RELIC", 5);
 }
+
+void ep_map_sim(ep_t *p, const uint8_t **msgs, const size_t *lens, int n,
+		const uint8_t *dst, size_t dst_len) {
+	/* enough space for two field elements plus extra bytes for uniformity */
+	const int len_per_elm = (FP_PRIME + ep_param_level() + 7) / 8;
+	uint8_t *buf = RLC_ALLOCA(uint8_t, 2 * len_per_elm * n);
+	fp_t *t = RLC_ALLOCA(fp_t, 2 * n);
+	ep_t *q = RLC_ALLOCA(ep_t, 2 * n);
+	int i, neg;
+	bn_t k;
+	fp_t u;
+
+	if (n <= 0) {
+		RLC_FREE(buf);
+		RLC_FREE(t);
+		RLC_FREE(q);
+		return;
+	}
+
+	bn_null(k);
+	fp_null(u);
+
+	RLC_TRY {
+		if (buf == NULL || t == NULL || q == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < 2 * n; i++) {
+			fp_null(t[i]);
+			ep_null(q[i]);
+			fp_new(t[i]);
+			ep_new(q[i]);
+		}
+		bn_new(k);
+		fp_new(u);
+
+		/* Hash all messages together, then to two field elements each. */
+		md_xmd_sim(buf, 2 * len_per_elm, msgs, lens, n, dst, dst_len);
+		for (i = 0; i < 2 * n; i++) {
+			bn_read_bin(k, buf + i * len_per_elm, len_per_elm);
+			fp_prime_conv(t[i], k);
+		}
+
+		/* Map all field elements with shared inversions. */
+		if (ep_curve_is_ctmap() || (ep_curve_opt_a() != RLC_ZERO &&
+				ep_curve_opt_b() != RLC_ZERO)) {
+			ep_map_sswu_sim(q, (const fp_t *)t, 2 * n);
+		} else {
+			ep_map_svdw_sim(q, (const fp_t *)t, 2 * n);
+		}
+		for (i = 0; i < 2 * n; i++) {
+			/* Make the sign of y match the sign of t. */
+			neg = fp_sgn0(t[i], k) != fp_sgn0(q[i]->y, k);
+			fp_neg(u, q[i]->y);
+			dv_copy_cond(q[i]->y, u, RLC_FP_DIGS, neg);
+			TMPL_MAP_CALL_ISOMAP(ep, q[i]);
+		}
+
+		/* Add the pairs, clear the cofactors and normalize everything. */
+		for (i = 0; i < n; i++) {
+			ep_add(p[i], q[2 * i], q[2 * i + 1]);
+		}
+		ep_norm_sim(p, (const ep_t *)p, n);
+		for (i = 0; i < n; i++) {
+			ep_map_cof(p[i], p[i]);
+		}
+		ep_norm_sim(p, (const ep_t *)p, n);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; i < 2 * n; i++) {
+			fp_free(t[i]);
+			ep_free(q[i]);
+		}
+		bn_free(k);
+		fp_free(u);
+		RLC_FREE(buf);
+		RLC_FREE(t);
+		RLC_FREE(q);
+	}
+}
@@ -790,3 +790,60 @@ void ep_mul_dig(ep_t r, const ep_t p, dig_t k) {
 		bn_free(_k);
 	}
 }
+
+void ep_mul_z(ep_t r, const ep_t p) {
+	const int *b;
+	int i, j, k, len;
+	ep_t t;
+
+	if (ep_is_infty(p)) {
+		ep_set_infty(r);
+		return;
+	}
+
+	b = fp_prime_get_par_sps(&len);
+	if (len == 0) {
+		RLC_THROW(ERR_NO_VALID);
+		ep_set_infty(r);
+		return;
+	}
+
+	ep_null(t);
+
+	RLC_TRY {
+		ep_new(t);
+
+		/* Run the signed chain of the seed from its most significant term. */
+		if (b[len - 1] < 0) {
+			ep_neg(t, p);
+		} else {
+			ep_copy(t, p);
+		}
+		k = (b[len - 1] < 0 ? -b[len - 1] : b[len - 1]);
+		for (i = len - 2; i >= 0; i--) {
+			j = (b[i] < 0 ? -b[i] : b[i]);
+			for (; k > j; k--) {
+				ep_dbl(t, t);
+			}
+			if (b[i] < 0) {
+				ep_sub(t, t, p);
+			} else {
+				ep_add(t, t, p);
+			}
+		}
+		for (; k > 0; k--) {
+			ep_dbl(t, t);
+		}
+		if (bn_sign(&(core_get()->par)) == RLC_NEG) {
+			ep_neg(r, t);
+		} else {
+			ep_copy(r, t);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		ep_free(t);
+	}
+}
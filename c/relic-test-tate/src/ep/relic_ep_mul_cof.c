@@ -0,0 +1,97 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2023 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of cofactor clearing on prime elliptic curves.
+ *
+ * @ingroup ep
+ */
+
+#include "relic_core.h"
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+void ep_mul_cof(ep_t r, const ep_t p) {
+	bn_t k, l;
+	ep_t t;
+
+	bn_null(k);
+	bn_null(l);
+	ep_null(t);
+
+	RLC_TRY {
+		bn_new(k);
+		bn_new(l);
+		ep_new(t);
+
+		switch (ep_curve_is_pairf()) {
+			case EP_BN:
+				/* h = 1 */
+				ep_copy(r, p);
+				break;
+			case EP_B12:
+			case EP_B24:
+				/* Multiply by (1-x) to get the correct group, as proven in
+				 * Piellard. https://eprint.iacr.org/2022/352.pdf */
+				ep_mul_z(t, p);
+				ep_sub(r, p, t);
+				ep_norm(r, r);
+				break;
+			case EP_BW13:
+				/* The cofactor is h = 3 * c^2 for c = (x^2 - x + 1)/3. Since
+				 * E(F_p) is a module over Z[psi] and c * (1 - psi) has norm h
+				 * and divides the Frobenius minus one, multiplying by it maps
+				 * E(F_p) onto G_1 with a 21-bit scalar instead of 43 bits. */
+				fp_prime_get_par(k);
+				bn_sqr(l, k);
+				bn_sub(l, l, k);
+				bn_add_dig(l, l, 1);
+				bn_div_dig(l, l, 3);
+				ep_psi(t, p);
+				ep_sub(t, p, t);
+				ep_mul_dig(r, t, l->dp[0]);
+				break;
+			default:
+				/* multiply by cofactor to get the correct group. */
+				ep_curve_get_cof(k);
+				if (bn_bits(k) < RLC_DIG) {
+					ep_mul_dig(r, p, k->dp[0]);
+				} else {
+					ep_mul_basic(r, p, k);
+				}
+				break;
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(k);
+		bn_free(l);
+		ep_free(t);
+	}
+}
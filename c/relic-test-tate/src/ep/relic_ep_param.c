@@ -419,6 +419,23 @@
 /** @} */
 #endif
 
+#if defined(EP_ENDOM) && FP_PRIME == 286
+/**
+ * Parameters for BW19-P286, a curve with embedding degree 19.
+ */
+/** @{ */
+#define BW19_P286_A		"0"
+#define BW19_P286_B		"1F"
+#define BW19_P286_X		"2D17DD18029BBFC11B813C0FBB403AF273D4811519C5FA9A864752602538AA89B4C1E3EA"
+#define BW19_P286_Y		"FBD5D4FAEE67815EDA61DF18F78EAE21D9A5AB198208532CB8162496E86FD165D11F04B"
+#define BW19_P286_R		"587277EA9C74F311978F6D898A5AC6C21D449A345073E782889329172828AEB21"
+#define BW19_P286_H		"8E7B863"
+#define BW19_P286_BETA	"31385F85CF579B231E440DE634F69D0267C3FD25E54E8B1FF939764354EDCA5676393784"
+#define BW19_P286_LAMB	"1561980FD913AB0BF96D419F550771035B1"
+#define BW19_P286_MAPU	"1"
+/** @} */
+#endif
+
 #if defined(EP_ENDOM) && FP_PRIME == 310
 /**
  * Parameters for BW13-P310
@@ -429,7 +446,7 @@
 #define BW13_P310_X		"66E61938A14C0A28822DEA7302F398E48A915D07482872BC176F5EE75D52467B9D86639C43C0"
 #define BW13_P310_Y		"2BBCC7879B8E77C9B41513D3567A8694FF56C316DF94D1F209E4CF1B70064F4DB59E7C7D4D9B3F"
 #define BW13_P310_R		"73ACDFCE88E6B386419A63DDDA057ED01B7E253E37867EED259476162F7697A2751"
-#define BW13_P310_H		"1"
+#define BW13_P310_H		"76C6A789ECB"
 #define BW13_P310_BETA  	"35AB7070426F80EE3BE37481D262A52C602EC3C3358CB273C8EE07296A31B4B7FB76648F3A62DB"
 #define BW13_P310_LAMB	        "175D42CD9CC96D446563A6BB0000000000000"
 #define BW13_P310_MAPU	"15"
@@ -998,6 +1015,14 @@ void ep_param_set(int param) {
 				break;
 #endif
 
+#if defined(EP_ENDOM) && FP_PRIME == 286
+			case BW19_P286:
+				ASSIGNK(BW19_P286, BW19_286);
+				endom = 1;
+				pairf = EP_BW19;
+				break;
+#endif
+
 #if defined(EP_ENDOM) && FP_PRIME == 310
 			case BW13_P310:
 				ASSIGNK(BW13_P310, BW13_310);
@@ -1226,6 +1251,7 @@ void ep_param_set(int param) {
 					bn_sub_dig(lamb, lamb, 1);
 					break;
 				case EP_BW13:
+				case EP_BW19:
 					break;
 				default:
 					if (bn_cmp_dig(h, 1) == RLC_EQ) {
@@ -1443,6 +1469,10 @@ int ep_param_set_any_pairf(void) {
 	ep_param_set(BN_P256);
 	type = RLC_EP_DTYPE;
 	degree = 2;
+#elif FP_PRIME == 286
+	ep_param_set(BW19_P286);
+	type = RLC_EP_DTYPE;
+	degree = 19;
 #elif FP_PRIME == 310
 	ep_param_set(BW13_P310);
 	type =  RLC_EP_DTYPE;
@@ -1548,8 +1578,18 @@ int ep_param_set_any_pairf(void) {
 			case 4:
 				ep4_curve_set_twist(type);
 				break;
+			case 8:
+				/* Compute the auxiliary data for membership testing. */
+				pc_core_calc();
+				break;
 			case 13:
 				ep13_curve_set();
+				/* Compute the auxiliary data for membership testing. */
+				pc_core_calc();
+				break;
+			case 19:
+				/* Only G_1 is supported, compute the membership test data. */
+				pc_core_calc();
 				break;
 		}
 	}
@@ -1616,6 +1656,9 @@ void ep_param_print(void) {
 		case BW13_P310:
 			util_banner("Curve BW13_P310:", 0);
 			break;
+		case BW19_P286:
+			util_banner("Curve BW19-P286:", 0);
+			break;
 		case B24_P315:
 			util_banner("Curve B24-P315:", 0);
 			break;
@@ -1716,10 +1759,11 @@ int ep_param_level(void) {
 		case B12_P381:
 		case BN_P382:
 		case BW13_P310:
+		case BW19_P286:
 		case B12_P383:
 		case BN_P446:
 		case B12_P446:
-		case GMT8_544:
+		case GMT8_P544:
 		case SS_P1536:
 			return 128;
 		case B12_P455:
@@ -1751,6 +1795,8 @@ int ep_param_embed(void) {
 			return 12;
 		case BW13_P310:
 			return 13;
+		case EP_BW19:
+			return 19;
 		case EP_K16:
 			return 16;
 		case EP_K18:
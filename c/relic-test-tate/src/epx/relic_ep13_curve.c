@@ -160,6 +160,51 @@
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
+void ep13_curve_init(void) {
+#if ALLOC != AUTO
+	ctx_t *ctx = core_get();
+	fp13_new(ctx->ep13_g.x);
+	fp13_new(ctx->ep13_g.y);
+	fp13_new(ctx->ep13_g.z);
+	fp13_new(ctx->frb13_1);
+	fp13_new(ctx->frb13_2);
+	fp13_new(ctx->frb13_3);
+	fp13_new(ctx->frb13_4);
+	fp13_new(ctx->frb13_5);
+	fp13_new(ctx->frb13_6);
+	fp13_new(ctx->frb13_7);
+	fp13_new(ctx->frb13_8);
+	fp13_new(ctx->frb13_9);
+	fp13_new(ctx->frb13_10);
+	fp13_new(ctx->frb13_11);
+	fp13_new(ctx->frb13_12);
+#endif
+	ep13_set_infty(&(core_get()->ep13_g));
+}
+
+void ep13_curve_clean(void) {
+#if ALLOC != AUTO
+	ctx_t *ctx = core_get();
+	if (ctx != NULL) {
+		fp13_free(ctx->ep13_g.x);
+		fp13_free(ctx->ep13_g.y);
+		fp13_free(ctx->ep13_g.z);
+		fp13_free(ctx->frb13_1);
+		fp13_free(ctx->frb13_2);
+		fp13_free(ctx->frb13_3);
+		fp13_free(ctx->frb13_4);
+		fp13_free(ctx->frb13_5);
+		fp13_free(ctx->frb13_6);
+		fp13_free(ctx->frb13_7);
+		fp13_free(ctx->frb13_8);
+		fp13_free(ctx->frb13_9);
+		fp13_free(ctx->frb13_10);
+		fp13_free(ctx->frb13_11);
+		fp13_free(ctx->frb13_12);
+	}
+#endif
+}
+
  void ep13_curve_set(){
     char str[2 * RLC_FP_BYTES + 1];
 	ctx_t *ctx = core_get();
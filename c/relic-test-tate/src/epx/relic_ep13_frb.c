@@ -50,4 +50,5 @@ void ep13_frb(ep13_t r, const ep13_t p, int i) {
 	fp13_frb(r->x, p->x, i);
 	fp13_frb(r->y, p->y, i);
 	fp13_frb(r->z, p->z, i);
+	r->coord = p->coord;
 }
@@ -304,27 +304,61 @@ void ep13_mul_lwnaf(ep13_t r, const ep13_t p, const bn_t k) {
 }
 
 #endif
-void  ep13_rand_mul_u(ep13_t r, const ep13_t q) {
-		RLC_TRY {
-		 ep13_dbl(r,q);
-		 ep13_dbl(r,r);
-		 ep13_dbl(r,r);
-		 ep13_dbl(r,r);
-		 ep13_add(r,r,q);
-		 ep13_dbl(r,r);
-		 ep13_dbl(r,r);
-		 ep13_add(r,r,q);
- 		 ep13_dbl(r,r);
-		 ep13_add(r,r,q);
-		 ep13_dbl(r,r);
-		 ep13_dbl(r,r);
-		 ep13_dbl(r,r);
-		 ep13_dbl(r,r);
-		 ep13_neg(r, r);
-		
-	} RLC_CATCH_ANY {
+
+void ep13_mul_z(ep13_t r, const ep13_t p) {
+	const int *b;
+	int i, j, k, len;
+	ep13_t t;
+
+	if (ep13_is_infty(p)) {
+		ep13_set_infty(r);
+		return;
+	}
+
+	b = fp_prime_get_par_sps(&len);
+	if (len == 0) {
+		RLC_THROW(ERR_NO_VALID);
+		ep13_set_infty(r);
+		return;
+	}
+
+	ep13_null(t);
+
+	RLC_TRY {
+		ep13_new(t);
+
+		/* Run the signed chain of the seed from its most significant term. */
+		if (b[len - 1] < 0) {
+			ep13_neg(t, p);
+		} else {
+			ep13_copy(t, p);
+		}
+		k = (b[len - 1] < 0 ? -b[len - 1] : b[len - 1]);
+		for (i = len - 2; i >= 0; i--) {
+			j = (b[i] < 0 ? -b[i] : b[i]);
+			for (; k > j; k--) {
+				ep13_dbl(t, t);
+			}
+			if (b[i] < 0) {
+				ep13_sub(t, t, p);
+			} else {
+				ep13_add(t, t, p);
+			}
+		}
+		for (; k > 0; k--) {
+			ep13_dbl(t, t);
+		}
+		if (bn_sign(&(core_get()->par)) == RLC_NEG) {
+			ep13_neg(r, t);
+		} else {
+			ep13_copy(r, t);
+		}
+	}
+	RLC_CATCH_ANY {
 		RLC_THROW(ERR_CAUGHT);
-	} RLC_FINALLY {
+	}
+	RLC_FINALLY {
+		ep13_free(t);
 	}
 }
 
@@ -345,13 +379,13 @@ void  ep13_cof(ep13_t r, const ep13_t p) {
 		ep13_sub(q, q, p);
 
 		ep13_dbl(R[14], q);
-		ep13_rand_mul_u(u0, q);//uQ
+		ep13_mul_z(u0, q);//uQ
 		ep13_sub(u1, u0, q);//(u-1)Q
-		ep13_rand_mul_u(u2, u0);//u^2Q
+		ep13_mul_z(u2, u0);//u^2Q
 		ep13_sub(R[12], u2, u1);//(u^2-u+1)Q
 		
 		for(int i=1; i<12; i++){
-			ep13_rand_mul_u(R[12-i], R[13-i]);
+			ep13_mul_z(R[12-i], R[13-i]);
 			ep13_neg(R[12-i], R[12-i]);
 		}
 		ep13_add(R[1], R[1], q);
@@ -394,19 +428,23 @@ void  ep13_cof_fuentes(ep13_t r, const ep13_t p) {
 	  ep13_null(u0);
 
 		RLC_TRY {
-			for(int i=0; i<15; i++)ep13_new(R[i]);
-	  		for(int i=0; i<13; i++)ep13_new(L[i]);
-	 		ep13_null(u0);
+			for(int i=0; i<15; i++) {
+				ep13_new(R[i]);
+			}
+	  		for(int i=0; i<13; i++) {
+				ep13_new(L[i]);
+			}
+	 		ep13_new(u0);
 			 /*mapping p into the cyclotomic zero subgroup,i.e., corrsponding to the mapping \tau*/
 			ep13_frb(R[0], p, 1);
 			ep13_sub(R[0], R[0], p);
 
-			for(int i=1; i<15; i++)ep13_rand_mul_u(R[i], R[i-1]);
+			for(int i=1; i<15; i++)ep13_mul_z(R[i], R[i-1]);
 		
 		/*L[i] corresponds to L_{i} in the paper*/
 			ep13_sub(L[0], R[14], R[13]);
 			ep13_add(L[0], L[0], R[12]);
-			for(int i=1; i<13; i++)ep13_rand_mul_u(L[i], L[i-1]);
+			for(int i=1; i<13; i++)ep13_mul_z(L[i], L[i-1]);
 
 		/*R[3*i+1] and R[3i+2] correspond to R_{i} and H_{i} in the paper*/
 			for(int i=0; i< 4; i++){
@@ -566,7 +566,7 @@ void ep2_curve_init(void) {
 	}
 #endif
 
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 	ep2_new(ctx->ep2_g);
 	fp2_new(ctx->ep2_a);
 	fp2_new(ctx->ep2_b);
@@ -579,7 +579,7 @@ void ep2_curve_init(void) {
 #endif
 
 #ifdef EP_PRECO
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 	for (int i = 0; i < RLC_EP_TABLE; i++) {
 		fp2_new(ctx->ep2_pre[i].x);
 		fp2_new(ctx->ep2_pre[i].y);
@@ -593,7 +593,7 @@ void ep2_curve_init(void) {
 
 #ifdef EP_CTMAP
 	iso2_t iso = ep2_curve_get_iso();
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 	fp2_new(iso->a);
 	fp2_new(iso->b);
 	for (unsigned i = 0; i < RLC_EPX_CTMAP_MAX; ++i) {
@@ -429,3 +429,60 @@ void ep2_mul_dig(ep2_t r, const ep2_t p, const dig_t k) {
 		bn_free(_k);
 	}
 }
+
+void ep2_mul_z(ep2_t r, const ep2_t p) {
+	const int *b;
+	int i, j, k, len;
+	ep2_t t;
+
+	if (ep2_is_infty(p)) {
+		ep2_set_infty(r);
+		return;
+	}
+
+	b = fp_prime_get_par_sps(&len);
+	if (len == 0) {
+		RLC_THROW(ERR_NO_VALID);
+		ep2_set_infty(r);
+		return;
+	}
+
+	ep2_null(t);
+
+	RLC_TRY {
+		ep2_new(t);
+
+		/* Run the signed chain of the seed from its most significant term. */
+		if (b[len - 1] < 0) {
+			ep2_neg(t, p);
+		} else {
+			ep2_copy(t, p);
+		}
+		k = (b[len - 1] < 0 ? -b[len - 1] : b[len - 1]);
+		for (i = len - 2; i >= 0; i--) {
+			j = (b[i] < 0 ? -b[i] : b[i]);
+			for (; k > j; k--) {
+				ep2_dbl(t, t);
+			}
+			if (b[i] < 0) {
+				ep2_sub(t, t, p);
+			} else {
+				ep2_add(t, t, p);
+			}
+		}
+		for (; k > 0; k--) {
+			ep2_dbl(t, t);
+		}
+		if (bn_sign(&(core_get()->par)) == RLC_NEG) {
+			ep2_neg(r, t);
+		} else {
+			ep2_copy(r, t);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		ep2_free(t);
+	}
+}
@@ -45,24 +45,19 @@
  * @param[in] p				- the point to multiply.
  */
 static void ep2_mul_cof_bn(ep2_t r, const ep2_t p) {
-	bn_t x;
 	ep2_t t0, t1, t2;
 
 	ep2_null(t0);
 	ep2_null(t1);
 	ep2_null(t2);
-	bn_null(x);
 
 	RLC_TRY {
 		ep2_new(t0);
 		ep2_new(t1);
 		ep2_new(t2);
-		bn_new(x);
-
-		fp_prime_get_par(x);
 
 		/* Compute t0 = xP. */
-		ep2_mul_basic(t0, p, x);
+		ep2_mul_z(t0, p);
 
 		/* Compute t1 = \psi(3xP). */
 		ep2_dbl(t1, t0);
@@ -87,7 +82,6 @@ static void ep2_mul_cof_bn(ep2_t r, const ep2_t p) {
 		ep2_free(t0);
 		ep2_free(t1);
 		ep2_free(t2);
-		bn_free(x);
 	}
 }
 
@@ -98,28 +92,23 @@ static void ep2_mul_cof_bn(ep2_t r, const ep2_t p) {
  * @param[in] p				- the point to multiply.
  */
 static void ep2_mul_cof_b12(ep2_t r, const ep2_t p) {
-	bn_t x;
 	ep2_t t0, t1, t2, t3;
 
 	ep2_null(t0);
 	ep2_null(t1);
 	ep2_null(t2);
 	ep2_null(t3);
-	bn_null(x);
 
 	RLC_TRY {
 		ep2_new(t0);
 		ep2_new(t1);
 		ep2_new(t2);
 		ep2_new(t3);
-		bn_new(x);
-
-		fp_prime_get_par(x);
 
 		/* Compute t0 = xP. */
-		ep2_mul_basic(t0, p, x);
+		ep2_mul_z(t0, p);
 		/* Compute t1 = [x^2]P. */
-		ep2_mul_basic(t1, t0, x);
+		ep2_mul_z(t1, t0);
 
 		/* t2 = (x^2 - x - 1)P = x^2P - x*P - P. */
 		ep2_sub(t2, t1, t0);
@@ -142,7 +131,6 @@ static void ep2_mul_cof_b12(ep2_t r, const ep2_t p) {
 		ep2_free(t1);
 		ep2_free(t2);
 		ep2_free(t3);
-		bn_free(x);
 	}
 }
 
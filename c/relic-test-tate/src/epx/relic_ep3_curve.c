@@ -140,14 +140,14 @@ void ep3_curve_init(void) {
 	}
 #endif
 
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 	ep3_new(ctx->ep3_g);
 	fp3_new(ctx->ep3_a);
 	fp3_new(ctx->ep3_b);
 #endif
 
 #ifdef EP_PRECO
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 	for (int i = 0; i < RLC_EP_TABLE; i++) {
 		fp3_new(ctx->ep3_pre[i].x);
 		fp3_new(ctx->ep3_pre[i].y);
@@ -198,14 +198,14 @@ void ep4_curve_init(void) {
 	}
 #endif
 
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 	ep4_new(ctx->ep4_g);
 	fp4_new(ctx->ep4_a);
 	fp4_new(ctx->ep4_b);
 #endif
 
 #ifdef EP_PRECO
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 	for (int i = 0; i < RLC_EP_TABLE; i++) {
 		fp4_new(ctx->ep4_pre[i].x);
 		fp4_new(ctx->ep4_pre[i].y);
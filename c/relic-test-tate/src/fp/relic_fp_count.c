@@ -0,0 +1,197 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2023 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the prime field operation counters.
+ *
+ * @ingroup fp
+ */
+
+/* The wrappers call the configured methods directly. */
+#define FP_NO_COUNT
+
+#include "relic_core.h"
+#include "relic_fp_low.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Executes an operation and counts it, unless it is called from inside
+ * another counted operation.
+ *
+ * @param[in] OP			- the operation counter.
+ * @param[in] CALL			- the call to the wrapped function.
+ */
+#define COUNT(OP, CALL)														\
+	thr_t *ctx = core_thr();												\
+	if (ctx->fp_lvl++ == 0) {												\
+		ctx->fp_cnt[OP]++;													\
+	}																		\
+	CALL;																	\
+	ctx->fp_lvl--;
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+void fp_count_reset(void) {
+#ifdef FP_COUNT
+	thr_t *ctx = core_thr();
+	memset(ctx->fp_cnt, 0, sizeof(ctx->fp_cnt));
+	ctx->fp_lvl = 0;
+#endif
+}
+
+void fp_count_get(ull_t *c) {
+#ifdef FP_COUNT
+	memcpy(c, core_thr()->fp_cnt, FP_OPS * sizeof(ull_t));
+#else
+	memset(c, 0, FP_OPS * sizeof(ull_t));
+#endif
+}
+
+#ifdef FP_COUNT
+
+void fp_add_cnt(fp_t c, const fp_t a, const fp_t b) {
+	COUNT(FP_OP_ADD, fp_add(c, a, b));
+}
+
+void fp_sub_cnt(fp_t c, const fp_t a, const fp_t b) {
+	COUNT(FP_OP_ADD, fp_sub(c, a, b));
+}
+
+void fp_neg_cnt(fp_t c, const fp_t a) {
+	COUNT(FP_OP_ADD, fp_neg(c, a));
+}
+
+void fp_dbl_cnt(fp_t c, const fp_t a) {
+	COUNT(FP_OP_ADD, fp_dbl(c, a));
+}
+
+void fp_hlv_cnt(fp_t c, const fp_t a) {
+	COUNT(FP_OP_ADD, fp_hlv(c, a));
+}
+
+void fp_mul_cnt(fp_t c, const fp_t a, const fp_t b) {
+	COUNT(FP_OP_MUL, fp_mul(c, a, b));
+}
+
+void fp_sqr_cnt(fp_t c, const fp_t a) {
+	COUNT(FP_OP_SQR, fp_sqr(c, a));
+}
+
+void fp_rdc_cnt(fp_t c, dv_t a) {
+	COUNT(FP_OP_RDC, fp_rdc(c, a));
+}
+
+void fp_inv_cnt(fp_t c, const fp_t a) {
+	COUNT(FP_OP_INV, fp_inv(c, a));
+}
+
+dig_t fp_addn_cnt(dig_t *c, const dig_t *a, const dig_t *b) {
+	dig_t r;
+	COUNT(FP_OP_ADD, r = fp_addn_low(c, a, b));
+	return r;
+}
+
+void fp_addm_cnt(dig_t *c, const dig_t *a, const dig_t *b) {
+	COUNT(FP_OP_ADD, fp_addm_low(c, a, b));
+}
+
+dig_t fp_addd_cnt(dig_t *c, const dig_t *a, const dig_t *b) {
+	dig_t r;
+	COUNT(FP_OP_ADDD, r = fp_addd_low(c, a, b));
+	return r;
+}
+
+void fp_addc_cnt(dig_t *c, const dig_t *a, const dig_t *b) {
+	COUNT(FP_OP_ADDD, fp_addc_low(c, a, b));
+}
+
+dig_t fp_subn_cnt(dig_t *c, const dig_t *a, const dig_t *b) {
+	dig_t r;
+	COUNT(FP_OP_ADD, r = fp_subn_low(c, a, b));
+	return r;
+}
+
+void fp_subm_cnt(dig_t *c, const dig_t *a, const dig_t *b) {
+	COUNT(FP_OP_ADD, fp_subm_low(c, a, b));
+}
+
+dig_t fp_subd_cnt(dig_t *c, const dig_t *a, const dig_t *b) {
+	dig_t r;
+	COUNT(FP_OP_ADDD, r = fp_subd_low(c, a, b));
+	return r;
+}
+
+void fp_subc_cnt(dig_t *c, const dig_t *a, const dig_t *b) {
+	COUNT(FP_OP_ADDD, fp_subc_low(c, a, b));
+}
+
+void fp_negm_cnt(dig_t *c, const dig_t *a) {
+	COUNT(FP_OP_ADD, fp_negm_low(c, a));
+}
+
+dig_t fp_dbln_cnt(dig_t *c, const dig_t *a) {
+	dig_t r;
+	COUNT(FP_OP_ADD, r = fp_dbln_low(c, a));
+	return r;
+}
+
+void fp_dblm_cnt(dig_t *c, const dig_t *a) {
+	COUNT(FP_OP_ADD, fp_dblm_low(c, a));
+}
+
+void fp_hlvm_cnt(dig_t *c, const dig_t *a) {
+	COUNT(FP_OP_ADD, fp_hlvm_low(c, a));
+}
+
+void fp_muln_cnt(dig_t *c, const dig_t *a, const dig_t *b) {
+	COUNT(FP_OP_MULN, fp_muln_low(c, a, b));
+}
+
+void fp_mulm_cnt(dig_t *c, const dig_t *a, const dig_t *b) {
+	COUNT(FP_OP_MUL, fp_mulm_low(c, a, b));
+}
+
+void fp_sqrn_cnt(dig_t *c, const dig_t *a) {
+	COUNT(FP_OP_SQRN, fp_sqrn_low(c, a));
+}
+
+void fp_sqrm_cnt(dig_t *c, const dig_t *a) {
+	COUNT(FP_OP_SQR, fp_sqrm_low(c, a));
+}
+
+void fp_rdcn_cnt(dig_t *c, dig_t *a) {
+	COUNT(FP_OP_RDC, fp_rdcn_low(c, a));
+}
+
+void fp_invm_cnt(dig_t *c, const dig_t *a) {
+	COUNT(FP_OP_INV, fp_invm_low(c, a));
+}
+
+#endif /* FP_COUNT */
@@ -188,170 +188,4 @@ void fp_exp_monty(fp_t c, const fp_t a, const bn_t b) {
 	}
 }
 
-
-void fp_exp_z(fp_t a, const fp_t b){
-    fp_t u0, u1, u2;
-	bn_t n;
-	bn_null(n);
-	fp_null(u0);
-	fp_null(u1);
-	fp_null(u2);
-	RLC_TRY{
-		bn_new(n);
-		fp_new(u0);
-		fp_new(u1);
-		fp_new(u2);
-		switch (ep_curve_is_pairf()){
-			case EP_B12:
-				#if FP_PRIME==381
-				fp_sqr(u0, b);
-				fp_mul(u0, u0, b);	
-				fp_sqr(u0, u0);
-				fp_sqr(u0, u0);
-				fp_mul(u0, u0, b);
-				fp_sqr(u0, u0);
-				fp_sqr(u0, u0);
-				fp_sqr(u0, u0);
-				fp_mul(u0, u0, b);
-				for(int i=0;i<9;i++)fp_sqr(u0, u0);
-				fp_mul(u0, u0, b);
-				for(int i=0;i<32;i++)fp_sqr(u0, u0);
-				fp_mul(u0, u0, b);
-				for(int i=0;i<16;i++)fp_sqr(u0, u0);
-				fp_copy(a, u0);			
-				#elif FP_PRIME==446
-				fp_sqr(u0, b);
-				fp_mul(u0, u0, b);	
-				for(int i=0;i<10;i++)fp_sqr(u0, u0);
-				fp_mul(u0, u0, b);
-				for(int i=0;i<6;i++)fp_sqr(u0, u0);
-				fp_mul(u0, u0, b);
-				for(int i=0;i<7;i++)fp_sqr(u0, u0);
-				fp_mul(u0, u0, b);
-				for(int i=0;i<33;i++)fp_sqr(u0, u0);
-				fp_mul(u0, u0, b);
-				for(int i=0;i<17;i++)fp_sqr(u0, u0);
-				fp_mul(u0, u0, b);
-				fp_copy(a, u0);	
-				#else
-					fp_prime_get_par(n);
-					if(bn_sign(n)==RLC_NEG)bn_neg(n,n);
-					fp_exp(a, b, n);
-				#endif
-				break;
-			case EP_B24:
-				#if FP_PRIME==315
-				fp_sqr(u0, b);
-				fp_mul(u1, u0, b);//3
-				fp_sqr(u2, u0);
-				fp_sqr(u0, u2);
-				fp_mul(u0, u0, u1);//11
-				fp_mul(u2, u0, u2);
-
-				for(int i=0; i<4; i++)fp_sqr(u0, u0);
-				fp_mul(u0, u0, u2);
-				fp_sqr(u0, u0);
-				fp_sqr(u0, u0);
-				fp_mul(u0, u0, u1);
-				fp_sqr(u0, u0);
-				fp_sqr(u0, u0);	
-				for(int i=0; i<4; i++)fp_sqr(u0, u0);
-				fp_mul(u0, u0, u2);
-				for(int i=0; i<4; i++)fp_sqr(u0, u0);
-				fp_mul(u0, u0, u2);
-				for(int i=0; i<4; i++)fp_sqr(u0, u0);
-				fp_mul(u0, u0, u2);
-				for(int i=0; i<4; i++)fp_sqr(u0, u0);
-				fp_mul(u0, u0, u2);
-				for(int i=0; i<4; i++)fp_sqr(u0, u0);
-				fp_mul(u0, u0, u2);
-				fp_copy(a, u0);
-				#elif FP_PRIME==509
-				fp_sqr(u0, b);
-				fp_mul(u1, u0, b);
-				fp_sqr(u2, u1);
-				fp_sqr(u2, u2);
-				fp_mul(u1, u1, u2);
-				fp_mul(u0, u1, b);
-				for(int i=0; i<23; i++)fp_sqr(u0, u0);
-			    fp_mul(u0, u0, u1);
-				for(int i=0; i<4; i++)fp_sqr(u0, u0);
-			    fp_mul(u0, u0, u1);		
-				for(int i=0; i<4; i++)fp_sqr(u0, u0);
-			    fp_mul(u0, u0, u1);	
-				for(int i=0; i<4; i++)fp_sqr(u0, u0);
-			    fp_mul(u0, u0, u1);	
-				fp_sqr(u0, u0);
-			    fp_mul(u0, u0, b);		
-				for(int i=0; i<11; i++)fp_sqr(u0, u0);
-			    fp_mul(u0, u0, b);	
-				fp_copy(a, u0);											
-				#else
-					fp_prime_get_par(n);
-					if(bn_sign(n)==RLC_NEG)bn_neg(n,n);
-					fp_exp(a, b, n);
-				#endif
-				break;	
-			case EP_B48:
-				#if FP_PRIME==575
-				fp_sqr(u0, b);
-				fp_mul(u1, u0, b);
-				fp_sqr(u2, u0);
-				fp_sqr(u0, u2);
-				fp_mul(u1, u0, u1);//11
-				fp_mul(u2, u1, u2);//15
-
-				fp_sqr(u0, u2);
-				for(int i=1; i<4; i++)fp_sqr(u0, u0);
-				fp_mul(u0, u0, u2);
-				for(int i=0; i<4; i++)fp_sqr(u0, u0);
-				fp_mul(u0, u0, u2);
-				for(int i=0; i<4; i++)fp_sqr(u0, u0);
-				fp_mul(u0, u0, u1);
-				for(int i=0; i<4; i++)fp_sqr(u0, u0);
-				fp_mul(u0, u0, u2);
-				for(int i=0; i<4; i++)fp_sqr(u0, u0);
-				fp_mul(u0, u0, u1);
-				for(int i=0; i<4; i++)fp_sqr(u0, u0);
-				fp_mul(u0, u0, u2);
-				for(int i=0; i<4; i++)fp_sqr(u0, u0);
-				fp_copy(a, u0);
-				#else
-					fp_prime_get_par(n);
-					if(bn_sign(n)==RLC_NEG)bn_neg(n,n);
-					fp_exp(a, b, n);
-				#endif
-				break;
-
-			case EP_BW13:
-				fp_sqr(u0, b);
-				fp_sqr(u0, u0);
-				fp_sqr(u0, u0);
-				fp_sqr(u0, u0);
-				fp_mul(u0, u0, b);
-				fp_sqr(u0, u0);
-				fp_sqr(u0, u0);
-				fp_mul(u0, u0, b);
-				fp_sqr(u0, u0);
-				fp_mul(u0, u0, b);
-				fp_sqr(u0, u0);
-				fp_sqr(u0, u0);
-				fp_sqr(u0, u0);
-				fp_sqr(u0, u0);
-				fp_copy(a, u0);
-				break;
-		}
-	}RLC_CATCH_ANY {
-		RLC_THROW(ERR_CAUGHT);
-	}
-	RLC_FINALLY {
-		bn_free(n);
-		fp_free(u0);
-		fp_free(u1);
-		fp_free(u2);
-	}
-
-} 			
-
-
 #endif
@@ -0,0 +1,498 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2023 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the exponentiation by the curve parameter in the prime
+ * field. Generated by tools/relic-gen-expz.py, do not edit.
+ *
+ * @ingroup fp
+ */
+
+#include "relic_core.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Number of precomputed powers used by the addition chain.
+ */
+#if FP_PRIME == 286
+#define EXPZ_TAB		1
+#elif FP_PRIME == 310
+#define EXPZ_TAB		1
+#elif FP_PRIME == 315
+#define EXPZ_TAB		9
+#elif FP_PRIME == 317
+#define EXPZ_TAB		9
+#elif FP_PRIME == 377
+#define EXPZ_TAB		9
+#elif FP_PRIME == 381
+#define EXPZ_TAB		1
+#elif FP_PRIME == 383
+#define EXPZ_TAB		1
+#elif FP_PRIME == 446
+#define EXPZ_TAB		1
+#elif FP_PRIME == 455
+#define EXPZ_TAB		1
+#elif FP_PRIME == 509
+#define EXPZ_TAB		11
+#elif FP_PRIME == 575
+#define EXPZ_TAB		7
+#elif FP_PRIME == 638
+#define EXPZ_TAB		10
+#else
+#define EXPZ_TAB		1
+#endif
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+void fp_exp_z(fp_t c, const fp_t a) {
+	fp_t r, t[EXPZ_TAB];
+	bn_t n;
+	int i;
+
+	bn_null(n);
+	fp_null(r);
+	for (i = 0; i < EXPZ_TAB; i++) {
+		fp_null(t[i]);
+	}
+
+	RLC_TRY {
+		bn_new(n);
+		fp_new(r);
+		for (i = 0; i < EXPZ_TAB; i++) {
+			fp_new(t[i]);
+		}
+
+		switch (fp_param_get()) {
+#if FP_PRIME == 286
+			case BW19_286:
+				/* |x| = 0x91, 7 squarings and 2 multiplications. */
+				fp_copy(t[0], a);
+				fp_copy(r, t[0]);
+				for (i = 0; i < 3; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[0]);
+				for (i = 0; i < 4; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[0]);
+				break;
+#endif
+#if FP_PRIME == 310
+			case BW13_310:
+				/* |x| = 0x8B0, 11 squarings and 3 multiplications. */
+				fp_copy(t[0], a);
+				fp_copy(r, t[0]);
+				for (i = 0; i < 4; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[0]);
+				for (i = 0; i < 2; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[0]);
+				fp_sqr(r, r);
+				fp_mul(r, r, t[0]);
+				for (i = 0; i < 4; i++) {
+					fp_sqr(r, r);
+				}
+				break;
+#endif
+#if FP_PRIME == 315
+			case B24_315:
+				/* |x| = 0xBFCFFFFF, 31 squarings and 9 multiplications. */
+				fp_copy(t[0], a);
+				fp_sqr(t[1], t[0]);
+				fp_sqr(t[2], t[1]);
+				fp_sqr(t[3], t[2]);
+				fp_mul(t[4], t[3], t[1]);
+				fp_sqr(t[5], t[4]);
+				fp_mul(t[6], t[5], t[1]);
+				fp_mul(t[7], t[6], t[0]);
+				fp_mul(t[8], t[7], t[3]);
+				fp_copy(r, t[7]);
+				for (i = 0; i < 5; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[8]);
+				for (i = 0; i < 7; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[8]);
+				for (i = 0; i < 5; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[8]);
+				for (i = 0; i < 5; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[8]);
+				for (i = 0; i < 5; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[8]);
+				break;
+#endif
+#if FP_PRIME == 317
+			case B24_317:
+				/* |x| = 0xD9018000, 31 squarings and 4 multiplications. */
+				fp_copy(t[0], a);
+				fp_sqr(t[1], t[0]);
+				fp_mul(t[2], t[1], t[0]);
+				fp_sqr(t[3], t[2]);
+				fp_sqr(t[4], t[3]);
+				fp_sqr(t[5], t[4]);
+				fp_sqr(t[6], t[5]);
+				fp_sqr(t[7], t[6]);
+				fp_mul(t[8], t[7], t[4]);
+				fp_copy(r, t[8]);
+				fp_sqr(r, r);
+				fp_mul(r, r, t[0]);
+				for (i = 0; i < 9; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[2]);
+				for (i = 0; i < 15; i++) {
+					fp_sqr(r, r);
+				}
+				break;
+#endif
+#if FP_PRIME == 377
+			case B12_377:
+				/* |x| = 0x8508C00000000001, 62 squarings and 6 multiplications. */
+				fp_copy(t[0], a);
+				fp_sqr(t[1], t[0]);
+				fp_mul(t[2], t[1], t[0]);
+				fp_sqr(t[3], t[2]);
+				fp_sqr(t[4], t[3]);
+				fp_sqr(t[5], t[4]);
+				fp_mul(t[6], t[5], t[3]);
+				fp_mul(t[7], t[6], t[2]);
+				fp_sqr(t[8], t[7]);
+				fp_copy(r, t[8]);
+				for (i = 0; i < 6; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[7]);
+				for (i = 0; i < 5; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[2]);
+				for (i = 0; i < 46; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[0]);
+				break;
+#endif
+#if FP_PRIME == 381
+			case B12_381:
+				/* |x| = 0xD201000000010000, 63 squarings and 5 multiplications. */
+				fp_copy(t[0], a);
+				fp_copy(r, t[0]);
+				fp_sqr(r, r);
+				fp_mul(r, r, t[0]);
+				for (i = 0; i < 2; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[0]);
+				for (i = 0; i < 3; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[0]);
+				for (i = 0; i < 9; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[0]);
+				for (i = 0; i < 32; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[0]);
+				for (i = 0; i < 16; i++) {
+					fp_sqr(r, r);
+				}
+				break;
+#endif
+#if FP_PRIME == 383
+			case B12_383:
+				/* |x| = 0x10008000001001200, 64 squarings and 4 multiplications. */
+				fp_copy(t[0], a);
+				fp_copy(r, t[0]);
+				for (i = 0; i < 13; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[0]);
+				for (i = 0; i < 27; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[0]);
+				for (i = 0; i < 12; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[0]);
+				for (i = 0; i < 3; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[0]);
+				for (i = 0; i < 9; i++) {
+					fp_sqr(r, r);
+				}
+				break;
+#endif
+#if FP_PRIME == 446
+			case B12_446:
+				/* |x| = 0x6008204000000020001, 74 squarings and 6 multiplications. */
+				fp_copy(t[0], a);
+				fp_copy(r, t[0]);
+				fp_sqr(r, r);
+				fp_mul(r, r, t[0]);
+				for (i = 0; i < 10; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[0]);
+				for (i = 0; i < 6; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[0]);
+				for (i = 0; i < 7; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[0]);
+				for (i = 0; i < 33; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[0]);
+				for (i = 0; i < 17; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[0]);
+				break;
+#endif
+#if FP_PRIME == 455
+			case B12_455:
+				/* |x| = 0x10000020000080000800, 76 squarings and 3 multiplications. */
+				fp_copy(t[0], a);
+				fp_copy(r, t[0]);
+				for (i = 0; i < 23; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[0]);
+				for (i = 0; i < 22; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[0]);
+				for (i = 0; i < 20; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[0]);
+				for (i = 0; i < 11; i++) {
+					fp_sqr(r, r);
+				}
+				break;
+#endif
+#if FP_PRIME == 509
+			case B24_509:
+				/* |x| = 0x800000FFFF801, 50 squarings and 9 multiplications. */
+				fp_copy(t[0], a);
+				fp_sqr(t[1], t[0]);
+				fp_sqr(t[2], t[1]);
+				fp_mul(t[3], t[2], t[0]);
+				fp_sqr(t[4], t[3]);
+				fp_mul(t[5], t[4], t[3]);
+				fp_sqr(t[6], t[5]);
+				fp_mul(t[7], t[6], t[0]);
+				fp_mul(t[8], t[7], t[0]);
+				fp_sqr(t[9], t[8]);
+				fp_sqr(t[10], t[9]);
+				fp_copy(r, t[10]);
+				for (i = 0; i < 20; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[5]);
+				for (i = 0; i < 4; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[5]);
+				for (i = 0; i < 4; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[5]);
+				for (i = 0; i < 5; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[7]);
+				for (i = 0; i < 11; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[0]);
+				break;
+#endif
+#if FP_PRIME == 575
+			case B48_575:
+				/* |x| = 0xFFFBFBF0, 31 squarings and 9 multiplications. */
+				fp_copy(t[0], a);
+				fp_sqr(t[1], t[0]);
+				fp_sqr(t[2], t[1]);
+				fp_sqr(t[3], t[2]);
+				fp_mul(t[4], t[3], t[1]);
+				fp_mul(t[5], t[4], t[0]);
+				fp_mul(t[6], t[5], t[2]);
+				fp_copy(r, t[6]);
+				for (i = 0; i < 4; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[6]);
+				for (i = 0; i < 4; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[6]);
+				for (i = 0; i < 4; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[5]);
+				for (i = 0; i < 4; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[6]);
+				for (i = 0; i < 4; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[5]);
+				for (i = 0; i < 4; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[6]);
+				for (i = 0; i < 4; i++) {
+					fp_sqr(r, r);
+				}
+				break;
+#endif
+#if FP_PRIME == 638
+			case B12_638:
+				/* |x| = 0x5FFDFFFFFFFFFFFFFFFFFFFFFE0, 105 squarings and 21 multiplications. */
+				fp_copy(t[0], a);
+				fp_sqr(t[1], t[0]);
+				fp_sqr(t[2], t[1]);
+				fp_mul(t[3], t[2], t[0]);
+				fp_sqr(t[4], t[3]);
+				fp_mul(t[5], t[4], t[3]);
+				fp_mul(t[6], t[5], t[0]);
+				fp_sqr(t[7], t[6]);
+				fp_mul(t[8], t[7], t[5]);
+				fp_mul(t[9], t[8], t[6]);
+				fp_copy(r, t[8]);
+				for (i = 0; i < 6; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[9]);
+				for (i = 0; i < 6; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[8]);
+				for (i = 0; i < 6; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[9]);
+				for (i = 0; i < 6; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[9]);
+				for (i = 0; i < 6; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[9]);
+				for (i = 0; i < 6; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[9]);
+				for (i = 0; i < 6; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[9]);
+				for (i = 0; i < 6; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[9]);
+				for (i = 0; i < 6; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[9]);
+				for (i = 0; i < 6; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[9]);
+				for (i = 0; i < 6; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[9]);
+				for (i = 0; i < 6; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[9]);
+				for (i = 0; i < 6; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[9]);
+				for (i = 0; i < 6; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[9]);
+				for (i = 0; i < 6; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[9]);
+				for (i = 0; i < 6; i++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[9]);
+				for (i = 0; i < 5; i++) {
+					fp_sqr(r, r);
+				}
+				break;
+#endif
+			default:
+				(void)t;
+				fp_prime_get_par(n);
+				bn_abs(n, n);
+				fp_exp(r, a, n);
+				break;
+		}
+		fp_copy(c, r);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(n);
+		fp_free(r);
+		for (i = 0; i < EXPZ_TAB; i++) {
+			fp_free(t[i]);
+		}
+	}
+}
@@ -278,6 +278,13 @@ void fp_param_set(int param) {
 				fp_prime_set_pairf(t0, EP_BN);
 				break;
 
+#elif FP_PRIME == 286
+			case BW19_286:
+				/* x = -145. */
+				bn_set_dig(t0, 145);
+				bn_neg(t0, t0);
+				fp_prime_set_pairf(t0, EP_BW19);
+				break;
 #elif FP_PRIME == 310
 			case BW13_310:
                              bn_set_2b(t0, 11);
@@ -694,6 +701,8 @@ int fp_param_set_any_tower(void) {
 	fp_param_set(BN_254);
 #elif FP_PRIME == 256
 	fp_param_set(BN_256);
+#elif FP_PRIME == 286
+	fp_param_set(BW19_286);
 #elif FP_PRIME == 310
 	fp_param_set(BW13_310);	
 #elif FP_PRIME == 315
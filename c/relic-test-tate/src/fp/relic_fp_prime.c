@@ -188,6 +188,7 @@ static void fp_prime_set(const bn_t p) {
 void fp_prime_init(void) {
 	ctx_t *ctx = core_get();
 	ctx->fp_id = 0;
+	fp_count_reset();
 	bn_make(&(ctx->prime), RLC_FP_DIGS);
 	bn_make(&(ctx->par), RLC_FP_DIGS);
 #if FP_RDC == QUICK || !defined(STRIP)
@@ -394,6 +395,28 @@ void fp_prime_set_pairf(const bn_t x, int pairf) {
 		       		bn_sub(p,p,t2);
 		        	fp_prime_set_dense(p);
 				break;
+			case EP_BW19:
+				/* p = (x + 1)^2 * (x^38 - x^19 + 1)/3 - x^39. */
+				bn_sqr(t1, t0);
+				bn_sqr(t1, t1);
+				bn_sqr(t1, t1);
+				bn_sqr(t1, t1);
+				bn_mul(t1, t1, t0);
+				bn_sqr(p, t0);
+				bn_mul(t1, t1, p);
+				bn_mul(p, t1, t0);
+				/* Now t1 = x^19 and p = x^20. */
+				bn_mul(t2, p, t1);
+				bn_sqr(p, t1);
+				bn_sub(p, p, t1);
+				bn_add_dig(p, p, 1);
+				bn_add_dig(t1, t0, 1);
+				bn_sqr(t1, t1);
+				bn_mul(p, p, t1);
+				bn_div_dig(p, p, 3);
+				bn_sub(p, p, t2);
+				fp_prime_set_dense(p);
+				break;
 			case EP_K18:
 				/* (x^8 + 5x^7 + 7x^6 + 37x^5 + 188x^4 + 259x^3 + 343x^2 +
 				   1763x + 2401)/21 */
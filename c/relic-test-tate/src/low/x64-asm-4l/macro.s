@@ -534,3 +534,126 @@
 	adcq %rdx,\R0
 	movq \R0,56(\C)
 .endm
+
+#if defined(__BMI2__) && defined(__ADX__)
+
+/* Accumulates the products a_i * a_j with i < j in a column into R0, R1, R2. */
+.macro SQRN_OFF i, j, R0, R1, R2, A
+	.if \i < \j
+		movq	8*\i(\A), %rdx
+		mulxq	8*\j(\A), %rax, %rdx
+		addq	%rax, \R0
+		adcq	%rdx, \R1
+		adcq	$0, \R2
+		SQRN_OFF "(\i + 1)", "(\j - 1)", \R0, \R1, \R2, \A
+	.endif
+.endm
+
+/* Computes columns k to 2n - 2 of the sum of products a_i * a_j with i < j. */
+.macro SQRN_TRI k, n, C, R0, R1, R2, A
+	.if \k < \n
+		SQRN_OFF 0, \k, \R0, \R1, \R2, \A
+	.else
+		SQRN_OFF "(\k - \n + 1)", "(\n - 1)", \R0, \R1, \R2, \A
+	.endif
+	movq	\R0, 8*\k(\C)
+	.if \k < 2 * \n - 3
+		xorq	\R0, \R0
+		SQRN_TRI "(\k + 1)", \n, \C, \R1, \R2, \R0, \A
+	.else
+		movq	\R1, 8*(\k + 1)(\C)
+	.endif
+.endm
+
+/* Doubles the partial result and adds the squares a_i^2, using two carry
+ * chains so that both steps run in a single pass. */
+.macro SQRN_DIAG i, n, C, T0, T1, T2, A
+	movq	8*\i(\A), %rdx
+	mulxq	%rdx, \T0, \T1
+	movq	16*\i(\C), \T2
+	adcxq	\T2, \T2
+	adoxq	\T0, \T2
+	movq	\T2, 16*\i(\C)
+	movq	16*\i+8(\C), \T2
+	adcxq	\T2, \T2
+	adoxq	\T1, \T2
+	movq	\T2, 16*\i+8(\C)
+	.if \i < \n - 1
+		SQRN_DIAG "(\i + 1)", \n, \C, \T0, \T1, \T2, \A
+	.endif
+.endm
+
+/* Squares an integer, computing each product a_i * a_j with i < j once. */
+.macro FP_SQRN_LOW C, R0, R1, R2, T0, T1, T2, A
+	xorq	\R0, \R0
+	xorq	\R1, \R1
+	xorq	\R2, \R2
+	movq	\R0, 0(\C)
+	movq	\R0, 8*(2 * 4 - 1)(\C)
+	SQRN_TRI 1, 4, \C, \R0, \R1, \R2, \A
+	xorl	%eax, %eax
+	SQRN_DIAG 0, 4, \C, \T0, \T1, \T2, \A
+.endm
+
+#else
+
+/* Accumulates the products a_i * a_j with i < j in a column into T0, T1, T2. */
+.macro SQRN_OFF i, j, T0, T1, T2, A
+	.if \i < \j
+		movq	8*\i(\A), %rax
+		mulq	8*\j(\A)
+		addq	%rax, \T0
+		adcq	%rdx, \T1
+		adcq	$0, \T2
+		SQRN_OFF "(\i + 1)", "(\j - 1)", \T0, \T1, \T2, \A
+	.endif
+.endm
+
+/* Computes column k of the square, doubling the products with i < j. */
+.macro SQRN_COL k, n, C, R0, R1, R2, T0, T1, T2, A
+	.if (\k > 0) && (\k < 2 * \n - 2)
+		xorq	\T0, \T0
+		xorq	\T1, \T1
+		xorq	\T2, \T2
+		.if \k < \n
+			SQRN_OFF 0, \k, \T0, \T1, \T2, \A
+		.else
+			SQRN_OFF "(\k - \n + 1)", "(\n - 1)", \T0, \T1, \T2, \A
+		.endif
+		addq	\T0, \T0
+		adcq	\T1, \T1
+		adcq	\T2, \T2
+		addq	\T0, \R0
+		adcq	\T1, \R1
+		adcq	\T2, \R2
+	.endif
+	.if ((\k) % 2) == 0
+		movq	8*((\k) / 2)(\A), %rax
+		mulq	%rax
+		addq	%rax, \R0
+		adcq	%rdx, \R1
+		adcq	$0, \R2
+	.endif
+	movq	\R0, 8*\k(\C)
+.endm
+
+/* Computes columns k to 2n - 1 of the square. */
+.macro SQRN k, n, C, R0, R1, R2, T0, T1, T2, A
+	SQRN_COL \k, \n, \C, \R0, \R1, \R2, \T0, \T1, \T2, \A
+	.if \k < 2 * \n - 2
+		xorq	\R0, \R0
+		SQRN	"(\k + 1)", \n, \C, \R1, \R2, \R0, \T0, \T1, \T2, \A
+	.else
+		movq	\R1, 8*(\k + 1)(\C)
+	.endif
+.endm
+
+/* Squares an integer, computing each product a_i * a_j with i < j once. */
+.macro FP_SQRN_LOW C, R0, R1, R2, T0, T1, T2, A
+	xorq	\R0, \R0
+	xorq	\R1, \R1
+	xorq	\R2, \R2
+	SQRN	0, 4, \C, \R0, \R1, \R2, \T0, \T1, \T2, \A
+.endm
+
+#endif
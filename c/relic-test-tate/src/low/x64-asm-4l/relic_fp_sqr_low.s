@@ -35,6 +35,17 @@
 
 .text
 .global cdecl(fp_sqrn_low)
+.global cdecl(fp_sqrm_low)
+
+#if defined(__BMI2__) && defined(__ADX__)
+
+cdecl(fp_sqrn_low):
+	push	%rbx
+	FP_SQRN_LOW %rdi, %r8, %r9, %r10, %r11, %rcx, %rbx, %rsi
+	pop		%rbx
+	ret
+
+#else
 
 /*
  * Function: fp_sqrn_low
@@ -134,3 +145,23 @@ cdecl(fp_sqrn_low):
 	adcq %rdx,%r11
 	movq %r11,56(%rdi)
 	ret
+
+#endif
+
+cdecl(fp_sqrm_low):
+	push	%r12
+	push	%r13
+	push	%r14
+	push	%rbx
+	subq	$64, %rsp
+
+	FP_SQRN_LOW %rsp, %r8, %r9, %r10, %r11, %rcx, %rbx, %rsi
+
+	FP_RDCN_LOW %rdi, %rsp
+
+	addq	$64, %rsp
+	pop		%rbx
+	pop		%r14
+	pop		%r13
+	pop		%r12
+	ret
@@ -1,6 +1,6 @@
 /*
  * RELIC is an Efficient LIbrary for Cryptography
- * Copyright (c) 2013 RELIC Authors
+ * Copyright (c) 2023 RELIC Authors
  *
  * This file is part of RELIC. RELIC is legal property of its developers,
  * whose names are not listed here. Please refer to the COPYRIGHT file
@@ -24,21 +24,44 @@
 /**
  * @file
  *
- * Implementation of low-level prime field squaring functions.
+ * Implementation of the low-level prime field squaring functions.
  *
  * @ingroup fp
  */
 
-#include "relic_fp.h"
-#include "relic_fp_low.h"
+#include "macro.s"
 
-/*============================================================================*/
-/* Public definitions                                                         */
-/*============================================================================*/
+.text
 
-void fp_sqrm_low(dig_t *c, const dig_t *a) {
-	dig_t rlc_align t[2 * RLC_FP_DIGS];
+.global fp_sqrn_low
+.global fp_sqrm_low
 
-	fp_sqrn_low(t, a);
-	fp_rdc(c, t);
-}
+fp_sqrn_low:
+	push	%rbx
+	FP_SQRN_LOW %rdi, %r8, %r9, %r10, %r11, %rcx, %rbx, %rsi
+	pop		%rbx
+	ret
+
+fp_sqrm_low:
+	push	%r12
+	push	%r13
+	push	%r14
+	push	%r15
+	push 	%rbx
+	push	%rbp
+	subq 	$80, %rsp
+
+	FP_SQRN_LOW %rsp, %r8, %r9, %r10, %r11, %rcx, %rbx, %rsi
+
+	leaq 	p0(%rip), %rbx
+	FP_RDCN_LOW %rdi, %r8, %r9, %r10, %rsp, %rbx
+
+	addq	$80, %rsp
+
+	pop		%rbp
+	pop		%rbx
+	pop		%r15
+	pop		%r14
+	pop		%r13
+	pop		%r12
+	ret
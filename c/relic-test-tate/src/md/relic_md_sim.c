@@ -0,0 +1,353 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2009 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of multi-buffer SHA-256 hashing of many messages.
+ *
+ * @ingroup md
+ */
+
+#include <string.h>
+
+#include "relic_conf.h"
+#include "relic_core.h"
+#include "relic_md.h"
+#include "sha.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+#if MD_MAP == SH256 || !defined(STRIP)
+
+/**
+ * Number of messages hashed in parallel. The state of all lanes is stored
+ * word-sliced, so each round is a loop over the lanes that the compiler maps
+ * to vector instructions when the target supports them.
+ */
+#define MD_LANES		8
+
+/**
+ * Maximum number of segments concatenated to form a lane input.
+ */
+#define MD_SEGS			4
+
+/**
+ * Represents the input of a lane as a concatenation of byte strings.
+ */
+typedef struct {
+	/** The segments. */
+	const uint8_t *seg[MD_SEGS];
+	/** The segment lengths in bytes. */
+	size_t len[MD_SEGS];
+	/** The total length in bytes. */
+	size_t total;
+} lane_t;
+
+/**
+ * Rotates a 32-bit word to the right.
+ */
+#define ROTR(W, B)		(((W) >> (B)) | ((W) << (32 - (B))))
+
+/**
+ * SHA-256 round constants.
+ */
+static const uint32_t md_k[64] = {
+	0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1,
+	0x923F82A4, 0xAB1C5ED5, 0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3,
+	0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174, 0xE49B69C1, 0xEFBE4786,
+	0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+	0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147,
+	0x06CA6351, 0x14292967, 0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13,
+	0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85, 0xA2BFE8A1, 0xA81A664B,
+	0xC24B8B70, 0xC76C51A3, 0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+	0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A,
+	0x5B9CCA4F, 0x682E6FF3, 0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208,
+	0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2
+};
+
+/**
+ * SHA-256 initial hash value.
+ */
+static const uint32_t md_iv[8] = {
+	0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A, 0x510E527F, 0x9B05688C,
+	0x1F83D9AB, 0x5BE0CD19
+};
+
+/**
+ * SHA-256 chaining value after absorbing one all-zero block, which is how
+ * every expand_message_xmd computation starts.
+ */
+static const uint32_t md_zpad[8] = {
+	0xDA5698BE, 0x17B9B469, 0x62335799, 0x779FBECA, 0x8CE5D491, 0xC0D26243,
+	0xBAFEF9EA, 0x1837A9D8
+};
+
+/**
+ * Compresses one message block in each lane.
+ *
+ * @param[out] s			- the resulting chaining values.
+ * @param[in] h				- the input chaining values.
+ * @param[in] m				- the message blocks.
+ */
+static void sh256_comp(uint32_t s[8][MD_LANES], uint32_t h[8][MD_LANES],
+		uint32_t m[16][MD_LANES]) {
+	uint32_t w[64][MD_LANES], v[8][MD_LANES], t1, t2;
+	int i, l;
+
+	for (i = 0; i < 16; i++) {
+		for (l = 0; l < MD_LANES; l++) {
+			w[i][l] = m[i][l];
+		}
+	}
+	for (i = 16; i < 64; i++) {
+		for (l = 0; l < MD_LANES; l++) {
+			t1 = w[i - 2][l];
+			t2 = w[i - 15][l];
+			w[i][l] = (ROTR(t1, 17) ^ ROTR(t1, 19) ^ (t1 >> 10)) + w[i - 7][l] +
+					(ROTR(t2, 7) ^ ROTR(t2, 18) ^ (t2 >> 3)) + w[i - 16][l];
+		}
+	}
+	for (i = 0; i < 8; i++) {
+		for (l = 0; l < MD_LANES; l++) {
+			v[i][l] = h[i][l];
+		}
+	}
+	for (i = 0; i < 64; i++) {
+		for (l = 0; l < MD_LANES; l++) {
+			t1 = v[7][l] + (ROTR(v[4][l], 6) ^ ROTR(v[4][l], 11) ^
+					ROTR(v[4][l], 25)) + ((v[4][l] & v[5][l]) ^
+					(~v[4][l] & v[6][l])) + md_k[i] + w[i][l];
+			t2 = (ROTR(v[0][l], 2) ^ ROTR(v[0][l], 13) ^ ROTR(v[0][l], 22)) +
+					((v[0][l] & v[1][l]) ^ (v[0][l] & v[2][l]) ^
+					(v[1][l] & v[2][l]));
+			v[7][l] = v[6][l];
+			v[6][l] = v[5][l];
+			v[5][l] = v[4][l];
+			v[4][l] = v[3][l] + t1;
+			v[3][l] = v[2][l];
+			v[2][l] = v[1][l];
+			v[1][l] = v[0][l];
+			v[0][l] = t1 + t2;
+		}
+	}
+	for (i = 0; i < 8; i++) {
+		for (l = 0; l < MD_LANES; l++) {
+			s[i][l] = h[i][l] + v[i][l];
+		}
+	}
+}
+
+/**
+ * Returns the number of blocks in the padded input of a lane.
+ *
+ * @param[in] in			- the lane input.
+ */
+static size_t sh256_blocks(const lane_t *in) {
+	return (in->total + 8) / SHA256_Message_Block_Size + 1;
+}
+
+/**
+ * Extracts one block of the padded input of a lane.
+ *
+ * @param[out] m			- the message block.
+ * @param[in] l				- the lane index.
+ * @param[in] in			- the lane input.
+ * @param[in] pre			- the number of bytes absorbed before the input.
+ * @param[in] b				- the block index.
+ */
+static void sh256_block(uint32_t m[16][MD_LANES], int l, const lane_t *in,
+		uint64_t pre, size_t b) {
+	uint8_t blk[SHA256_Message_Block_Size];
+	size_t i, j, lo, hi, off = b * SHA256_Message_Block_Size;
+	uint64_t bits;
+
+	memset(blk, 0, sizeof(blk));
+	for (i = j = 0; i < MD_SEGS; j += in->len[i], i++) {
+		lo = RLC_MAX(j, off);
+		hi = RLC_MIN(j + in->len[i], off + sizeof(blk));
+		if (lo < hi) {
+			memcpy(blk + lo - off, in->seg[i] + lo - j, hi - lo);
+		}
+	}
+	if (in->total >= off && in->total < off + sizeof(blk)) {
+		blk[in->total - off] = 0x80;
+	}
+	if (b + 1 == sh256_blocks(in)) {
+		bits = (pre + in->total) << 3;
+		for (i = 0; i < 8; i++) {
+			blk[sizeof(blk) - 1 - i] = (uint8_t)(bits >> (8 * i));
+		}
+	}
+	for (i = 0; i < 16; i++) {
+		m[i][l] = ((uint32_t)blk[4 * i] << 24) | ((uint32_t)blk[4 * i + 1] << 16)
+				| ((uint32_t)blk[4 * i + 2] << 8) | (uint32_t)blk[4 * i + 3];
+	}
+}
+
+/**
+ * Hashes up to MD_LANES lane inputs in parallel.
+ *
+ * @param[out] out			- the digests.
+ * @param[in] in			- the lane inputs.
+ * @param[in] n				- the number of lanes in use.
+ * @param[in] iv			- the initial chaining value.
+ * @param[in] pre			- the number of bytes absorbed before each input.
+ */
+static void sh256_lanes(uint8_t *out[], const lane_t *in, int n,
+		const uint32_t iv[8], uint64_t pre) {
+	uint32_t h[8][MD_LANES], s[8][MD_LANES], m[16][MD_LANES];
+	size_t b, nb[MD_LANES], max = 0;
+	int i, l;
+
+	for (l = 0; l < MD_LANES; l++) {
+		nb[l] = (l < n ? sh256_blocks(&in[l]) : 0);
+		max = RLC_MAX(max, nb[l]);
+		for (i = 0; i < 8; i++) {
+			h[i][l] = iv[i];
+		}
+	}
+	memset(m, 0, sizeof(m));
+
+	for (b = 0; b < max; b++) {
+		for (l = 0; l < n; l++) {
+			if (b < nb[l]) {
+				sh256_block(m, l, &in[l], pre, b);
+			}
+		}
+		sh256_comp(s, h, m);
+		/* Lanes with shorter inputs keep their final chaining value. */
+		for (l = 0; l < MD_LANES; l++) {
+			if (b < nb[l]) {
+				for (i = 0; i < 8; i++) {
+					h[i][l] = s[i][l];
+				}
+			}
+		}
+	}
+
+	for (l = 0; l < n; l++) {
+		for (i = 0; i < 8; i++) {
+			out[l][4 * i] = (uint8_t)(h[i][l] >> 24);
+			out[l][4 * i + 1] = (uint8_t)(h[i][l] >> 16);
+			out[l][4 * i + 2] = (uint8_t)(h[i][l] >> 8);
+			out[l][4 * i + 3] = (uint8_t)h[i][l];
+		}
+	}
+}
+
+#endif
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+#if MD_MAP == SH256 || !defined(STRIP)
+
+void md_map_sh256_sim(uint8_t *hash, const uint8_t **msg, const size_t *len,
+		int n) {
+	lane_t in[MD_LANES];
+	uint8_t *out[MD_LANES];
+	int i, j, l;
+
+	memset(in, 0, sizeof(in));
+	for (i = 0; i < n; i += MD_LANES) {
+		l = RLC_MIN(MD_LANES, n - i);
+		for (j = 0; j < l; j++) {
+			in[j].seg[0] = msg[i + j];
+			in[j].len[0] = in[j].total = len[i + j];
+			out[j] = hash + (i + j) * SHA256HashSize;
+		}
+		sh256_lanes(out, in, l, md_iv, 0);
+	}
+}
+
+void md_xmd_sh256_sim(uint8_t *buf, size_t buf_len, const uint8_t **in,
+		const size_t *in_len, int n, const uint8_t *dst, size_t dst_len) {
+	const size_t ell = (buf_len + SHA256HashSize - 1) / SHA256HashSize;
+	const uint8_t l_i_b_0_str[] = {buf_len >> 8, buf_len & 0xFF, 0, dst_len};
+	uint8_t b_0[MD_LANES][SHA256HashSize];
+	uint8_t b_i[MD_LANES][SHA256HashSize + 1];
+	uint8_t *out[MD_LANES];
+	lane_t lane[MD_LANES];
+	size_t i, k;
+	int j, l, m;
+
+	if (ell > 255 || dst_len > 255) {
+		RLC_THROW(ERR_NO_VALID);
+		return;
+	}
+
+	memset(lane, 0, sizeof(lane));
+	for (j = 0; j < n; j += MD_LANES) {
+		m = RLC_MIN(MD_LANES, n - j);
+
+		/* Compute b_0 = H(Z_pad || msg || l_i_b_str || 0 || DST_prime), with
+		 * the hash of Z_pad given by a constant chaining value. */
+		for (l = 0; l < m; l++) {
+			lane[l].seg[0] = in[j + l];
+			lane[l].len[0] = in_len[j + l];
+			lane[l].seg[1] = l_i_b_0_str;
+			lane[l].len[1] = 3;
+			lane[l].seg[2] = dst;
+			lane[l].len[2] = dst_len;
+			lane[l].seg[3] = l_i_b_0_str + 3;
+			lane[l].len[3] = 1;
+			lane[l].total = in_len[j + l] + dst_len + 4;
+			out[l] = b_0[l];
+		}
+		sh256_lanes(out, lane, m, md_zpad, SHA256_Message_Block_Size);
+
+		/* Compute b_i = H((b_0 ^ b_(i-1)) || i || DST_prime) in all lanes. */
+		memset(b_i, 0, sizeof(b_i));
+		for (l = 0; l < m; l++) {
+			lane[l].seg[0] = b_i[l];
+			lane[l].len[0] = SHA256HashSize + 1;
+			lane[l].seg[1] = dst;
+			lane[l].len[1] = dst_len;
+			lane[l].seg[2] = l_i_b_0_str + 3;
+			lane[l].len[2] = 1;
+			lane[l].len[3] = 0;
+			lane[l].total = SHA256HashSize + dst_len + 2;
+			out[l] = b_i[l];
+		}
+		for (i = 1; i <= ell; i++) {
+			for (l = 0; l < m; l++) {
+				for (k = 0; k < SHA256HashSize; k++) {
+					b_i[l][k] ^= b_0[l][k];
+				}
+				b_i[l][SHA256HashSize] = i;
+			}
+			sh256_lanes(out, lane, m, md_iv, 0);
+			k = RLC_MIN(SHA256HashSize, buf_len - (i - 1) * SHA256HashSize);
+			for (l = 0; l < m; l++) {
+				memcpy(buf + (j + l) * buf_len + (i - 1) * SHA256HashSize,
+						b_i[l], k);
+			}
+		}
+	}
+}
+
+#endif
@@ -38,7 +38,13 @@
 /*============================================================================*/
 
 void pc_core_init(void) {
-	gt_new(core_get()->gt_g);
+	ctx_t *ctx = core_get();
+
+	gt_new(ctx->gt_g);
+	ctx->tate_len = 0;
+	ctx->tate_vec = 0;
+	g1_set_infty(&(ctx->tate_q));
+	tate_tab_null(&(ctx->tate_tab));
 }
 
 void pc_core_calc(void) {
@@ -55,11 +61,28 @@ void pc_core_calc(void) {
 		g2_new(g2);
 		gt_new(gt);
 
-		g1_get_gen(g1);
-		g2_get_gen(g2);
+		/* There is no G_2 arithmetic for BW13, BW19 and BLS48 curves here. */
+		if (ep_curve_is_pairf() != EP_BW13 && ep_curve_is_pairf() != EP_BW19 &&
+				ep_curve_is_pairf() != EP_B48) {
+			g1_get_gen(g1);
+			g2_get_gen(g2);
+
+			pc_map(gt, g1, g2);
+			gt_copy(core_get()->gt_g, gt);
+		}
+
+		/* Recode the Miller loop of the Tate test once per curve. */
+		core_get()->tate_len = tate_sched(core_get()->tate_op);
+		tate_vec_calc();
 
-		pc_map(gt, g1, g2);
-		gt_copy(core_get()->gt_g, gt);
+		/* Find the auxiliary point and Miller table for the Tate test. */
+		if (g1_tate_gen(g1) && !g1_is_infty(g1)) {
+			g1_copy(&(core_get()->tate_q), g1);
+			tate_tab_make(&(core_get()->tate_tab), g1);
+		} else {
+			g1_set_infty(&(core_get()->tate_q));
+			tate_tab_free(&(core_get()->tate_tab));
+		}
 	} RLC_CATCH_ANY {
 		RLC_THROW(ERR_CAUGHT);
 	} RLC_FINALLY {
@@ -73,5 +96,6 @@ void pc_core_clean(void) {
 	ctx_t *ctx = core_get();
 	if (ctx != NULL) {
 		gt_free(core_get()->gt_g);
+		tate_tab_free(&(ctx->tate_tab));
 	}
 }
@@ -253,9 +253,104 @@ void gt_exp_gen(gt_t c, const bn_t b) {
 }
 
 
+/**
+ * Computes a and c such that a/c = b^((p - 1)/e), where e is the order of the
+ * auxiliary point of a BLS curve. When 9 divides e, the cheaper exponent used
+ * by tate_exp1() does not see points of order 9 and this one must be used.
+ * Write e = |z - 1| and z0 = (z - 1)/3, so that (p - 1)/e is, up to sign,
+ * z0 * (z^2m - z^m + 1) + 1 with m = k/6.
+ *
+ * @param[out] a			- the numerator.
+ * @param[out] c			- the denominator.
+ * @param[in] b				- the element to exponentiate.
+ * @return 1 if 9 divides e and the result was computed, 0 otherwise.
+ */
+static int tate_exp9(fp_t a, fp_t c, const fp_t b) {
+	int i, m, r = 0;
+	dig_t d;
+	bn_t e, z;
+	fp_t u, v, w;
+
+	bn_null(e);
+	bn_null(z);
+	fp_null(u);
+	fp_null(v);
+	fp_null(w);
+
+	RLC_TRY {
+		bn_new(e);
+		bn_new(z);
+		fp_new(u);
+		fp_new(v);
+		fp_new(w);
+
+		if (tate_ord(e) && bn_cmp_dig(e, 1) == RLC_GT) {
+			bn_mod_dig(&d, e, 9);
+			r = (d == 0);
+		}
+		if (r) {
+			switch (ep_curve_is_pairf()) {
+				case EP_B12:
+					m = 2;
+					break;
+				case EP_B24:
+					m = 4;
+					break;
+				case EP_B48:
+					m = 8;
+					break;
+				default:
+					m = 0;
+					break;
+			}
+			if (m == 0) {
+				tate_exp2(a, (dig_t *)b);
+				fp_set_dig(c, 1);
+			} else {
+				/* Compute u = b^|z0|, v = u^(z^m) and w = u^(z^2m). */
+				fp_prime_get_par(z);
+				bn_div_dig(e, e, 3);
+				fp_exp(u, b, e);
+				fp_copy(v, u);
+				for (i = 0; i < m; i++) {
+					fp_exp_z(v, v);
+				}
+				fp_copy(w, v);
+				for (i = 0; i < m; i++) {
+					fp_exp_z(w, w);
+				}
+				if (bn_sign(z) == RLC_POS) {
+					/* b^(z0 * (z^2m - z^m + 1) + 1) = w * u * b / v. */
+					fp_mul(u, u, b);
+					fp_mul(a, w, u);
+					fp_copy(c, v);
+				} else {
+					/* b^(z0 * (z^2m - z^m + 1) + 1) = b * v / (w * u). */
+					fp_mul(a, b, v);
+					fp_mul(c, w, u);
+				}
+			}
+		}
+	} RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	} RLC_FINALLY {
+		bn_free(e);
+		bn_free(z);
+		fp_free(u);
+		fp_free(v);
+		fp_free(w);
+	}
+	return r;
+}
+
 void tate_exp1(fp_t a, fp_t c, fp_t b){
 	bn_t n;
 	fp_t u0, u1, u2, u3;
+
+	if (tate_exp9(a, c, b)) {
+		return;
+	}
+
 	bn_null(n);
 	fp_null(u0);
 	fp_null(u1);
@@ -481,6 +576,13 @@ void tate_exp1(fp_t a, fp_t c, fp_t b){
 					fp_copy(c, u1);
 				}
 				break;
+			default:
+				/* Without a chain in z, use the full exponent (p - 1)/e. For
+				 * BW19 curves, fp_exp_z() is not cheaper than a sliding window
+				 * and 38 calls to it lose to the single exponentiation. */
+				tate_exp2(a, b);
+				fp_set_dig(c, 1);
+				break;
 		}
 	}
 	RLC_CATCH_ANY {
@@ -508,26 +610,13 @@ void tate_exp2(fp_t a, fp_t b){
 		p->used = RLC_FP_DIGS;
 		dv_copy(p->dp, fp_prime_get(), RLC_FP_DIGS);
 		bn_sub_dig(p, p, 1);
-		fp_prime_get_par(n);
-		switch (ep_curve_is_pairf()){
-			case EP_B12:
-			case EP_B24:
-			case EP_B48:
-				bn_sub_dig(n, n, 1);
-				bn_div(n, p, n);
-				if (bn_sign(n) == RLC_NEG)bn_neg(n, n);
-				fp_exp(c, b, n);
-				fp_copy(a, c);
-				break;
-			case EP_BW13:
-				bn_t u;
-				bn_sqr(u, n);
-				bn_sub(n, u, n);	
-				bn_add_dig(n, n, 1);
-				bn_div(n, p, n);
-				fp_exp(c, b, n);
-				fp_copy(a, c);
-				break;		
+		/* The exponent is (p - 1)/e for the order e of the auxiliary point. */
+		if (tate_ord(n)) {
+			bn_div(n, p, n);
+			fp_exp(c, b, n);
+			fp_copy(a, c);
+		} else {
+			RLC_THROW(ERR_NO_VALID);
 		}
 	}
 	RLC_CATCH_ANY {
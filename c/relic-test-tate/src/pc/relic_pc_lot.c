@@ -0,0 +1,212 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2023 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of bulk membership testing distributed among threads.
+ *
+ * @ingroup pc
+ */
+
+#include "relic_pc.h"
+#include "relic_core.h"
+#include "relic_util.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Groups that can be validated in bulk.
+ */
+enum {
+	/** Elements of G_1 checked with the precomputed Tate test. */
+	LOT_G1,
+	/** Elements of G_2 on BW13 curves. */
+	LOT_G2_BW13,
+	/** Elements of G_T on BW13 curves. */
+	LOT_GT_BW13
+};
+
+/**
+ * Work shared by all threads validating a lot of elements.
+ */
+typedef struct {
+	/** The group of the elements. */
+	int type;
+	/** The validity flag of each element. */
+	int *res;
+	/** The elements to check. */
+	const void *a;
+	/** The number of elements. */
+	int n;
+	/** The auxiliary point for the Tate test. */
+	ep_st *q;
+	/** The read-only Miller table for the Tate test. */
+	fp_t *tab;
+	/** The library context shared by the workers. */
+	ctx_t *ctx;
+	/** The first element of the next chunk to be processed. */
+	int next;
+} lot_t;
+
+/**
+ * Checks a single element from the lot.
+ *
+ * @param[in] lot			- the work description.
+ * @param[in] i				- the index of the element.
+ * @return 1 if the element is valid, 0 otherwise.
+ */
+static int lot_check(const lot_t *lot, int i) {
+	switch (lot->type) {
+		case LOT_G1:
+			return g1_is_valid_tate_pre(((g1_t *)lot->a)[i], lot->q, lot->tab);
+		case LOT_G2_BW13:
+			return g2_is_valid_bw13(((ep13_t *)lot->a)[i]);
+		case LOT_GT_BW13:
+			return gt_is_valid_bw13(((fp13_t *)lot->a)[i]);
+	}
+	return 0;
+}
+
+#if MULTI == PTHREAD
+
+/**
+ * Processes chunks of consecutive elements until the lot is exhausted.
+ *
+ * @param[in] ptr			- the work description.
+ */
+static void *lot_worker(void *ptr) {
+	lot_t *lot = (lot_t *)ptr;
+	int i, j;
+
+	core_set(lot->ctx);
+	while ((i = __sync_fetch_and_add(&lot->next, RLC_PC_CHUNK)) < lot->n) {
+		for (j = i; j < RLC_MIN(i + RLC_PC_CHUNK, lot->n); j++) {
+			lot->res[j] = lot_check(lot, j);
+		}
+	}
+	return NULL;
+}
+
+#endif
+
+/**
+ * Validates a lot of elements, distributing chunks among threads.
+ *
+ * @param[in,out] lot		- the work description.
+ * @param[in] t				- the number of threads.
+ * @return 1 if all elements are valid, 0 otherwise.
+ */
+static int lot_run(lot_t *lot, int t) {
+	int i, r = 1;
+
+	if (t <= 0) {
+		t = CORES;
+	}
+	lot->ctx = core_get();
+	lot->next = 0;
+
+#if MULTI == OPENMP
+	omp_set_num_threads(t);
+	#pragma omp parallel for copyin(core_ctx) schedule(dynamic, RLC_PC_CHUNK)
+	for (i = 0; i < lot->n; i++) {
+		lot->res[i] = lot_check(lot, i);
+	}
+#elif MULTI == PTHREAD
+	pthread_t *thread = RLC_ALLOCA(pthread_t, t);
+
+	if (thread == NULL) {
+		RLC_THROW(ERR_NO_MEMORY);
+		return 0;
+	}
+	/* The calling thread also processes chunks. */
+	for (i = 1; i < t; i++) {
+		if (pthread_create(&thread[i], NULL, lot_worker, lot)) {
+			break;
+		}
+	}
+	t = i;
+	lot_worker(lot);
+	for (i = 1; i < t; i++) {
+		pthread_join(thread[i], NULL);
+	}
+	RLC_FREE(thread);
+#else
+	(void)t;
+	for (i = 0; i < lot->n; i++) {
+		lot->res[i] = lot_check(lot, i);
+	}
+#endif
+
+	for (i = 0; i < lot->n; i++) {
+		r &= lot->res[i];
+	}
+	return r;
+}
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+int g1_is_valid_tate_lot(int *res, const g1_t *a, int n, int t) {
+	ctx_t *ctx = core_get();
+	lot_t lot;
+
+	if (ctx->tate_tab.tab == NULL) {
+		RLC_THROW(ERR_NO_VALID);
+		return 0;
+	}
+	lot.type = LOT_G1;
+	lot.res = res;
+	lot.a = a;
+	lot.n = n;
+	lot.q = &(ctx->tate_q);
+	lot.tab = ctx->tate_tab.tab;
+	return lot_run(&lot, t);
+}
+
+int g2_is_valid_bw13_lot(int *res, const ep13_t *a, int n, int t) {
+	lot_t lot;
+
+	lot.type = LOT_G2_BW13;
+	lot.res = res;
+	lot.a = a;
+	lot.n = n;
+	lot.q = NULL;
+	lot.tab = NULL;
+	return lot_run(&lot, t);
+}
+
+int gt_is_valid_bw13_lot(int *res, const fp13_t *a, int n, int t) {
+	lot_t lot;
+
+	lot.type = LOT_GT_BW13;
+	lot.res = res;
+	lot.a = a;
+	lot.n = n;
+	lot.q = NULL;
+	lot.tab = NULL;
+	return lot_run(&lot, t);
+}
@@ -37,6 +37,7 @@ void tate_qpl(fp_t f1, fp_t g1, fp_t f2, fp_t g2, g1_t q, g1_t p, g1_t p2){
 	fp_t t0, tt0, t1, t2, t3, t4, t5;
 	dv_t u0, u1, u2;
 	g1_t _q;
+	g1_null(_q);
 	fp_null(t0);
 	fp_null(tt0);
 	fp_null(t1);
@@ -49,12 +50,14 @@ void tate_qpl(fp_t f1, fp_t g1, fp_t f2, fp_t g2, g1_t q, g1_t p, g1_t p2){
 	dv_null(u2);
 
 	RLC_TRY {
+		g1_new(_q);
 		fp_new(t0);
 		fp_new(tt0);
 		fp_new(t1);
 		fp_new(t2);
 		fp_new(t3);
 		fp_new(t4);
+		fp_new(t5);
 		dv_new(u0);
 		dv_new(u1);
 		dv_new(u2);
@@ -135,6 +138,7 @@ void tate_qpl(fp_t f1, fp_t g1, fp_t f2, fp_t g2, g1_t q, g1_t p, g1_t p2){
 		RLC_THROW(ERR_CAUGHT);
 	}
 	RLC_FINALLY {
+		g1_free(_q);
 		fp_free(t0);
 		fp_free(tt0);
 		fp_free(t1);
@@ -154,6 +158,7 @@ void tate_dba(fp_t f1, fp_t g1, fp_t f2, fp_t g2,  g1_t r, g1_t q, g1_t p, g1_t
 	fp_t t0, tt0, t1, tt1, t2, t3, t4, t5;
 	dv_t u0, u1, u2;
 	g1_t _q;
+	g1_null(_q);
 	fp_null(t0);
 	fp_null(tt0);
 	fp_null(t1);
@@ -167,6 +172,7 @@ void tate_dba(fp_t f1, fp_t g1, fp_t f2, fp_t g2,  g1_t r, g1_t q, g1_t p, g1_t
 	dv_null(u2);
 
 	RLC_TRY {
+		g1_new(_q);
 		fp_new(t0);
 		fp_new(tt0);
 		fp_new(t1);
@@ -256,6 +262,7 @@ void tate_dba(fp_t f1, fp_t g1, fp_t f2, fp_t g2,  g1_t r, g1_t q, g1_t p, g1_t
 		RLC_THROW(ERR_CAUGHT);
 	}
 	RLC_FINALLY {
+		g1_free(_q);
 		fp_free(t0);
 		fp_free(tt0);
 		fp_free(tt1);
@@ -274,6 +281,7 @@ void tate_add(fp_t f1, fp_t g1, fp_t f2, fp_t g2, g1_t r, g1_t q, g1_t p, g1_t p
 	fp_t t0, tt0, tt1, t1, t2, t3, t4;
 	dv_t u0, u1;
 	g1_t _r;
+	g1_null(_r);
 	
 	fp_null(t0);
 	fp_null(tt0);
@@ -287,10 +295,11 @@ void tate_add(fp_t f1, fp_t g1, fp_t f2, fp_t g2, g1_t r, g1_t q, g1_t p, g1_t p
 
 
 	RLC_TRY {
+		g1_new(_r);
 		fp_new(t0);
-		fp_null(tt0);
+		fp_new(tt0);
 		fp_new(t1);
-		fp_null(tt1);
+		fp_new(tt1);
 		fp_new(t2);
 		fp_new(t3);
 		fp_new(t4);
@@ -343,6 +352,7 @@ void tate_add(fp_t f1, fp_t g1, fp_t f2, fp_t g2, g1_t r, g1_t q, g1_t p, g1_t p
 		RLC_THROW(ERR_CAUGHT);
 	}
 	RLC_FINALLY {
+		g1_free(_r);
 		fp_free(t0);
 	        fp_free(tt0);
 		fp_free(t1);
@@ -350,17 +360,17 @@ void tate_add(fp_t f1, fp_t g1, fp_t f2, fp_t g2, g1_t r, g1_t q, g1_t p, g1_t p
 		fp_free(t2);
 		fp_free(t3);
 		fp_free(t4);
-		fp_free(t5);
-		fp_free(t6);
-		dv2_free(u0);
-		dv2_free(u1);
+		dv_free(u0);
+		dv_free(u1);
 	}
 }
 
-void tate_sub(fp_t f1, fp_t g1, fp_t f2, fp_t g2, g1_t r, g1_t q, g1_t p, g1_t p2) {
+void tate_sub(fp_t f1, fp_t g1, fp_t f2, fp_t g2, g1_t r, g1_t q, g1_t p, g1_t p2,
+		const fp_t d1, const fp_t d2, const fp_t d3) {
 	fp_t t0, tt0, tt1, t1, t2, t3, t4;
 	dv_t u0, u1;
 	g1_t _r;
+	g1_null(_r);
 	
 	fp_null(t0);
 	fp_null(tt0);
@@ -374,10 +384,11 @@ void tate_sub(fp_t f1, fp_t g1, fp_t f2, fp_t g2, g1_t r, g1_t q, g1_t p, g1_t p
 
 
 	RLC_TRY {
+		g1_new(_r);
 		fp_new(t0);
-		fp_null(tt0);
+		fp_new(tt0);
 		fp_new(t1);
-		fp_null(tt1);
+		fp_new(tt1);
 		fp_new(t2);
 		fp_new(t3);
 		fp_new(t4);
@@ -389,8 +400,7 @@ void tate_sub(fp_t f1, fp_t g1, fp_t f2, fp_t g2, g1_t r, g1_t q, g1_t p, g1_t p
 		fp_sqr(t0, r->z);
 		fp_mul(tt1, r->z, t0);  
 		fp_mul(t2, tt1, q->y);	
-		fp_add(t1, t2, r->y);
-		fp_neg(t1, t1);//sita
+		fp_add(t1, t2, r->y);//-sita
 		fp_mul(tt0, t0, q->x);
 		fp_sub(tt0, tt0, r->x);//lambda
 		fp_sqr(t2, tt0);//lambda^2
@@ -401,7 +411,7 @@ void tate_sub(fp_t f1, fp_t g1, fp_t f2, fp_t g2, g1_t r, g1_t q, g1_t p, g1_t p
 		fp_dbl(r->x, t2);
 		fp_sub(r->x, t4, r->x);
 		fp_muln_low(u0, r->y, t3);
-		fp_sub(t2, t2, r->x);
+		fp_sub(t2, r->x, t2);
 		fp_muln_low(u1, t2, t1);
 		fp_subc_low(u1, u1, u0);
 		fp_rdc(r->y, u1);
@@ -415,19 +425,15 @@ void tate_sub(fp_t f1, fp_t g1, fp_t f2, fp_t g2, g1_t r, g1_t q, g1_t p, g1_t p
 		fp_mul(f2, t0, p2->x);
 		fp_sub(f2, f2, r->x);
 		
-		fp_sub(t0, p->y, q->y);
-		fp_muln_low(u0, t0, r->z);
-		
-		fp_sub(t0, p->x, q->x);
-		fp_muln_low(u1, t0, t1);
-		fp_addc_low(u1, u0, u1);
+		fp_muln_low(u0, d3, r->z);
+
+		fp_muln_low(u1, d1, t1);
+		fp_subc_low(u1, u0, u1);
 		fp_rdc(t0, u1);
 		fp_mul(g1, t0, r->z);
-		
-		fp_sub(t0, p2->x, q->x);
 
-		fp_muln_low(u1, t0, t1);
-		fp_addc_low(u0, u0, u1);
+		fp_muln_low(u1, d2, t1);
+		fp_subc_low(u0, u0, u1);
 		fp_rdc(t0, u0);	
 		fp_mul(g2, t0, r->z);		
 		
@@ -437,6 +443,7 @@ void tate_sub(fp_t f1, fp_t g1, fp_t f2, fp_t g2, g1_t r, g1_t q, g1_t p, g1_t p
 		RLC_THROW(ERR_CAUGHT);
 	}
 	RLC_FINALLY {
+		g1_free(_r);
 		fp_free(t0);
 	        fp_free(tt0);
 		fp_free(t1);
@@ -444,16 +451,15 @@ void tate_sub(fp_t f1, fp_t g1, fp_t f2, fp_t g2, g1_t r, g1_t q, g1_t p, g1_t p
 		fp_free(t2);
 		fp_free(t3);
 		fp_free(t4);
-		fp_free(t5);
-		fp_free(t6);
-		dv2_free(u0);
-		dv2_free(u1);
+		dv_free(u0);
+		dv_free(u1);
 	}
 }
 void tate_dbl(fp_t f1, fp_t g1, fp_t f2, fp_t g2, g1_t q, g1_t p, g1_t p2){
 	fp_t t0, t1, t2, t3, t4, t5;
 	dv_t u0, u1, u2;
 	g1_t _q;
+	g1_null(_q);
 	fp_null(t0);
 	fp_null(t1);
 	fp_null(t2);
@@ -465,11 +471,13 @@ void tate_dbl(fp_t f1, fp_t g1, fp_t f2, fp_t g2, g1_t q, g1_t p, g1_t p2){
 	dv_null(u2);
 
 	RLC_TRY {
+		g1_new(_q);
 		fp_new(t0);
 		fp_new(t1);
 		fp_new(t2);
 		fp_new(t3);
 		fp_new(t4);
+		fp_new(t5);
 		dv_new(u0);
 		dv_new(u1);
 		dv_new(u2);
@@ -527,6 +535,7 @@ void tate_dbl(fp_t f1, fp_t g1, fp_t f2, fp_t g2, g1_t q, g1_t p, g1_t p2){
 		RLC_THROW(ERR_CAUGHT);
 	}
 	RLC_FINALLY {
+		g1_free(_q);
 		fp_free(t0);
 		fp_free(t1);
 		fp_free(t2);
@@ -541,10 +550,12 @@ void tate_dbl(fp_t f1, fp_t g1, fp_t f2, fp_t g2, g1_t q, g1_t p, g1_t p2){
 	}
 }
 
-void tate_dbs(fp_t f1, fp_t g1, fp_t f2, fp_t g2,  g1_t r, g1_t q, g1_t p, g1_t p2) {
+void tate_dbs(fp_t f1, fp_t g1, fp_t f2, fp_t g2,  g1_t r, g1_t q, g1_t p, g1_t p2,
+		const fp_t d1, const fp_t d2) {
 	fp_t t0, tt0, t1, tt1, t2, t3, t4, t5;
 	dv_t u0, u1, u2;
 	g1_t _q;
+	g1_null(_q);
 	fp_null(t0);
 	fp_null(tt0);
 	fp_null(t1);
@@ -558,6 +569,7 @@ void tate_dbs(fp_t f1, fp_t g1, fp_t f2, fp_t g2,  g1_t r, g1_t q, g1_t p, g1_t
 	dv_null(u2);
 
 	RLC_TRY {
+		g1_new(_q);
 		fp_new(t0);
 		fp_new(tt0);
 		fp_new(t1);
@@ -595,8 +607,7 @@ void tate_dbs(fp_t f1, fp_t g1, fp_t f2, fp_t g2,  g1_t r, g1_t q, g1_t p, g1_t
 		fp_sqr(t5, _q->z);//
 		fp_mul(tt1, _q->z, t5);  //
 		fp_mul(t2, tt1, q->y);	
-		fp_add(t1, t2, _q->y);
-		fp_neg(t1, t1);//sita
+		fp_add(t1, t2, _q->y);//-sita
 		fp_mul(tt0, t5, q->x);
 		fp_sub(tt0, tt0, _q->x);//b
 		fp_sqr(t2, tt0);//b^2
@@ -608,7 +619,7 @@ void tate_dbs(fp_t f1, fp_t g1, fp_t f2, fp_t g2,  g1_t r, g1_t q, g1_t p, g1_t
 		fp_sub(r->x, t4, r->x);
 
 		fp_muln_low(u0, _q->y, t3);
-		fp_sub(t2, t2, r->x);
+		fp_sub(t2, r->x, t2);
 		fp_muln_low(u1, t2, t1);
 		fp_subc_low(u1, u1, u0);
 		fp_rdc(r->y, u1);
@@ -625,25 +636,23 @@ void tate_dbs(fp_t f1, fp_t g1, fp_t f2, fp_t g2,  g1_t r, g1_t q, g1_t p, g1_t
 		fp_mul(t0, t0, tt0);//C
 		fp_muln_low(u0, tt1, tt0);
 		fp_muln_low(u1, t2, t1);
-		fp_subc_low(u1, u0,u1);
+		fp_addc_low(u1, u0, u1);
 		fp_rdc(f1, u1);
 		
 		fp_muln_low(u1, t4, t1);
-		fp_subc_low(u1, u0, u1);
+		fp_addc_low(u1, u0, u1);
 		fp_rdc(f2, u1);
 		fp_muln_low(u1, t0, t2);
 		fp_addc_low(u1, u0, u1);
 		fp_rdc(t2, u1);//E
-		fp_sub(g1, p->x, q->x);
-		fp_mul(g1, g1, t2);
+		fp_mul(g1, d1, t2);
 		
 		
 		
 		fp_muln_low(u1, t0, t4);
 		fp_addc_low(u1, u0, u1);
 		fp_rdc(t2, u1);//E
-		fp_sub(g2, p2->x, q->x);
-		fp_mul(g2, g2, t2);
+		fp_mul(g2, d2, t2);
 				
 		
 				
@@ -654,6 +663,7 @@ void tate_dbs(fp_t f1, fp_t g1, fp_t f2, fp_t g2,  g1_t r, g1_t q, g1_t p, g1_t
 		RLC_THROW(ERR_CAUGHT);
 	}
 	RLC_FINALLY {
+		g1_free(_q);
 		fp_free(t0);
 		fp_free(tt0);
 		fp_free(tt1);
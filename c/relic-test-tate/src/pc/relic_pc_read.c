@@ -0,0 +1,425 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2024 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of validating deserialization of elements of G_1.
+ *
+ * Decoding a compressed point already proves that it lies on the curve, so
+ * the fused routines skip the second on-curve check done by ep_read_bin() and
+ * feed the affine point directly to the precomputed Tate test. The batched
+ * routine also shares the inversions of the Miller values among all points.
+ *
+ * @ingroup pc
+ */
+
+#include "relic_pc.h"
+#include "relic_core.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Kinds of encodings of a point.
+ */
+enum {
+	/** A malformed encoding. */
+	READ_BAD,
+	/** The point at infinity. */
+	READ_INF,
+	/** A point with both coordinates. */
+	READ_FULL,
+	/** A compressed point. */
+	READ_PACK
+};
+
+/**
+ * Reads a canonical element of the prime field.
+ *
+ * @param[out] c			- the field element.
+ * @param[in] t				- a temporary integer.
+ * @param[in] bin			- the byte vector with RLC_FP_BYTES bytes.
+ * @return 1 if the value is smaller than the prime, 0 otherwise.
+ */
+static int read_fp(fp_t c, bn_t t, const uint8_t *bin) {
+	bn_read_bin(t, bin, RLC_FP_BYTES);
+	if (bn_cmp(t, &core_get()->prime) != RLC_LT) {
+		return 0;
+	}
+	if (bn_is_zero(t)) {
+		fp_zero(c);
+	} else if (t->used == 1) {
+		fp_prime_conv_dig(c, t->dp[0]);
+	} else {
+		fp_prime_conv(c, t);
+	}
+	return 1;
+}
+
+/**
+ * Decodes a point without validating it. For compressed points, the y
+ * coordinate holds the right-hand side of the curve equation on return.
+ *
+ * @param[out] a			- the decoded point.
+ * @param[out] sign			- the sign of the y coordinate of a compressed point.
+ * @param[in] t				- a temporary integer.
+ * @param[in] bin			- the byte vector.
+ * @param[in] len			- the buffer capacity.
+ * @return the kind of encoding.
+ */
+static int read_point(ep_t a, int *sign, bn_t t, const uint8_t *bin,
+		size_t len) {
+	if (len == 1) {
+		ep_set_infty(a);
+		return (bin[0] == 0 ? READ_INF : READ_BAD);
+	}
+	a->coord = BASIC;
+	fp_set_dig(a->z, 1);
+	if (len == RLC_FP_BYTES + 1 && (bin[0] == 2 || bin[0] == 3)) {
+		if (read_fp(a->x, t, bin + 1)) {
+			*sign = bin[0] - 2;
+			ep_rhs(a->y, a);
+			return READ_PACK;
+		}
+	}
+	if (len == 2 * RLC_FP_BYTES + 1 && bin[0] == 4) {
+		if (read_fp(a->x, t, bin + 1) &&
+				read_fp(a->y, t, bin + RLC_FP_BYTES + 1)) {
+			return READ_FULL;
+		}
+	}
+	ep_set_infty(a);
+	return READ_BAD;
+}
+
+/**
+ * Computes the exponents shared by the decompression of all points.
+ *
+ * @param[out] e			- the exponent (p + 1)/4, or zero if p = 1 mod 4.
+ * @param[out] h			- the bound (p - 1)/2 for the sign of y.
+ */
+static void read_consts(bn_t e, bn_t h) {
+	h->used = RLC_FP_DIGS;
+	dv_copy(h->dp, fp_prime_get(), RLC_FP_DIGS);
+	bn_trim(h);
+	if (fp_prime_get_mod8() == 3 || fp_prime_get_mod8() == 7) {
+		bn_add_dig(e, h, 1);
+		bn_rsh(e, e, 2);
+	} else {
+		bn_zero(e);
+	}
+	bn_hlv(h, h);
+}
+
+/**
+ * Recovers the y coordinate of a compressed point from the right-hand side of
+ * the curve equation, following the sign convention of ep_upk().
+ *
+ * @param[in,out] a			- the point.
+ * @param[in] sign			- the sign of the y coordinate.
+ * @param[in] t				- a temporary integer.
+ * @param[in] u				- a temporary field element.
+ * @param[in] v				- a temporary field element.
+ * @param[in] e				- the exponent computed by read_consts().
+ * @param[in] h				- the bound computed by read_consts().
+ * @return 1 if the point lies on the curve, 0 otherwise.
+ */
+static int read_root(ep_t a, int sign, bn_t t, fp_t u, fp_t v,
+		const bn_t e, const bn_t h) {
+	int r, b;
+
+	if (bn_is_zero(e)) {
+		r = fp_srt(u, a->y);
+	} else {
+		/* Squaring the candidate root also checks that a root exists. */
+		fp_exp(u, a->y, e);
+		fp_sqr(v, u);
+		r = (fp_cmp(v, a->y) == RLC_EQ);
+	}
+	if (r) {
+		if (ep_curve_is_pairf()) {
+			fp_prime_back(t, u);
+			b = (bn_cmp(t, h) == RLC_GT);
+		} else {
+			b = fp_get_bit(u, 0);
+		}
+		if (b != sign) {
+			fp_neg(u, u);
+		}
+		fp_copy(a->y, u);
+	}
+	return r;
+}
+
+/**
+ * Computes the Miller values of the precomputed Tate test for an affine point
+ * on the curve, leaving the inversion of the denominator to the caller.
+ *
+ * @param[out] f1			- the numerator of the first Miller value.
+ * @param[out] f2			- the numerator of the second Miller value.
+ * @param[out] d			- the common denominator.
+ * @param[in] p				- the point to test.
+ * @return 1 if the Miller values are well defined, 0 otherwise.
+ */
+static int read_miller(fp_t f1, fp_t f2, fp_t d, ep_t p) {
+	ctx_t *ctx = core_get();
+	fp_t N1, D1, N2, D2;
+	ep_t p2;
+	int r = 0;
+
+	ep_null(p2);
+	fp_null(N1);
+	fp_null(D1);
+	fp_null(N2);
+	fp_null(D2);
+
+	RLC_TRY {
+		ep_new(p2);
+		fp_new(N1);
+		fp_new(D1);
+		fp_new(N2);
+		fp_new(D2);
+		ep_psi(p2, p);
+		fp_sub(N1, p->x, ctx->tate_q.x);
+		fp_sub(N2, p2->x, ctx->tate_q.x);
+		fp_set_dig(D1, 1);
+		fp_set_dig(D2, 1);
+		tate_miller_vec(ctx->tate_tab.tab, N1, D1, N2, D2, &(ctx->tate_q), p,
+				p2);
+		if (!fp_is_zero(N1) && !fp_is_zero(D1) && !fp_is_zero(N2) &&
+				!fp_is_zero(D2)) {
+			fp_mul(f1, N1, D2);
+			fp_mul(f2, N2, D1);
+			fp_mul(d, D1, D2);
+			r = 1;
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		ep_free(p2);
+		fp_free(N1);
+		fp_free(D1);
+		fp_free(N2);
+		fp_free(D2);
+	}
+	return r;
+}
+
+/**
+ * Finishes the Tate test from the inverted Miller values of a point.
+ *
+ * @param[in] f1			- the first Miller value.
+ * @param[in] f2			- the second Miller value.
+ * @return 1 if the point is in G_1, 0 otherwise.
+ */
+static int read_final(fp_t f1, fp_t f2) {
+	fp_t a, c;
+	int r = 0;
+
+	fp_null(a);
+	fp_null(c);
+
+	RLC_TRY {
+		fp_new(a);
+		fp_new(c);
+		tate_exp1(a, c, f1);
+		tate_exp2(f2, f2);
+		r = (fp_cmp(a, c) == RLC_EQ) && (fp_cmp_dig(f2, 1) == RLC_EQ);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp_free(a);
+		fp_free(c);
+	}
+	return r;
+}
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+int g1_read_bin_valid(g1_t a, const uint8_t *bin, size_t len) {
+	int k, sign = 0, r = 0;
+	bn_t e, h, t;
+	fp_t f1, f2, d;
+
+	bn_null(e);
+	bn_null(h);
+	bn_null(t);
+	fp_null(f1);
+	fp_null(f2);
+	fp_null(d);
+
+	RLC_TRY {
+		bn_new(e);
+		bn_new(h);
+		bn_new(t);
+		fp_new(f1);
+		fp_new(f2);
+		fp_new(d);
+
+		k = read_point(a, &sign, t, bin, len);
+		if (k == READ_PACK) {
+			read_consts(e, h);
+			r = read_root(a, sign, t, f1, f2, e, h);
+		} else if (k == READ_FULL) {
+			r = ep_on_curve(a);
+		}
+		if (r) {
+			if (g1_tate_get_tab() != NULL) {
+				r = read_miller(f1, f2, d, a);
+				if (r) {
+					fp_inv(d, d);
+					fp_mul(f1, f1, d);
+					fp_mul(f2, f2, d);
+					r = read_final(f1, f2);
+				}
+			} else {
+				r = g1_is_valid(a);
+			}
+		}
+		if (!r) {
+			g1_set_infty(a);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(e);
+		bn_free(h);
+		bn_free(t);
+		fp_free(f1);
+		fp_free(f2);
+		fp_free(d);
+	}
+	return r;
+}
+
+int g1_read_bin_valid_sim(g1_t *out, int *ok, const uint8_t **in,
+		const size_t *len, int n) {
+	int i, k, m = 0, sign = 0, r = 1;
+	int *idx = RLC_ALLOCA(int, n);
+	fp_t *f1 = RLC_ALLOCA(fp_t, n), *f2 = RLC_ALLOCA(fp_t, n);
+	fp_t *d = RLC_ALLOCA(fp_t, n);
+	bn_t e, h, t;
+
+	if (n <= 0) {
+		RLC_FREE(idx);
+		RLC_FREE(f1);
+		RLC_FREE(f2);
+		RLC_FREE(d);
+		return 1;
+	}
+
+	bn_null(e);
+	bn_null(h);
+	bn_null(t);
+
+	RLC_TRY {
+		if (idx == NULL || f1 == NULL || f2 == NULL || d == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < n; i++) {
+			fp_null(f1[i]);
+			fp_null(f2[i]);
+			fp_null(d[i]);
+			fp_new(f1[i]);
+			fp_new(f2[i]);
+			fp_new(d[i]);
+		}
+		bn_new(e);
+		bn_new(h);
+		bn_new(t);
+
+		/* The exponents for the square roots are computed once, and the
+		 * Miller values are used as scratch space. */
+		read_consts(e, h);
+		for (i = 0; i < n; i++) {
+			k = read_point(out[i], &sign, t, in[i], len[i]);
+			ok[i] = 0;
+			if (k == READ_PACK) {
+				ok[i] = read_root(out[i], sign, t, f1[i], f2[i], e, h);
+			} else if (k == READ_FULL) {
+				ok[i] = ep_on_curve(out[i]);
+			}
+		}
+
+		if (g1_tate_get_tab() != NULL) {
+			for (i = 0; i < n; i++) {
+				if (ok[i]) {
+					ok[i] = read_miller(f1[m], f2[m], d[m], out[i]);
+					if (ok[i]) {
+						idx[m++] = i;
+					}
+				}
+			}
+			if (m > 0) {
+				/* Share a single inversion among all Miller values. */
+				fp_inv_sim(d, (const fp_t *)d, m);
+				for (i = 0; i < m; i++) {
+					fp_mul(f1[i], f1[i], d[i]);
+					fp_mul(f2[i], f2[i], d[i]);
+					ok[idx[i]] = read_final(f1[i], f2[i]);
+				}
+			}
+		} else {
+			for (i = 0; i < n; i++) {
+				if (ok[i]) {
+					ok[i] = g1_is_valid(out[i]);
+				}
+			}
+		}
+
+		for (i = 0; i < n; i++) {
+			if (!ok[i]) {
+				g1_set_infty(out[i]);
+			}
+			r &= ok[i];
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; i < n; i++) {
+			fp_free(f1[i]);
+			fp_free(f2[i]);
+			fp_free(d[i]);
+		}
+		bn_free(e);
+		bn_free(h);
+		bn_free(t);
+		RLC_FREE(idx);
+		RLC_FREE(f1);
+		RLC_FREE(f2);
+		RLC_FREE(d);
+	}
+	return r;
+}
@@ -30,8 +30,19 @@
 #include <stdio.h>
 #include "relic_pc.h"
 #include "relic_core.h"
+#include "relic_fp_low.h"
 #include"relic_fpx_low.h"
 #include "relic_util.h"
+#if defined(EP_ENDOM) && FP_PRIME == 286
+/**
+* points for G1 testing on a 286-bit pairing-friendly prime curve.
+*/
+/** @{ */
+#define BW19_P286_X0	"1CF0B8A74A96C07BC1E71B96A55C8D7D2487680D50BCF9396E7F940C1CD172638851EDC6"
+#define BW19_P286_Y0	"2B547D922E3F71D86573084AC7963B548724FB8A54415CDC58ED52DB6A7B6910DF6476BA"
+/** @} */
+#endif
+
 #if defined(EP_ENDOM) && FP_PRIME == 310
 /**
 * points for G1 testing on a 310-bit pairing-friendly prime curve.
@@ -101,193 +112,608 @@
 
 
 
-void g1_tate_gen(g1_t g){
-    char str[2 * RLC_FP_BYTES + 2];
-	#if defined(EP_ENDOM) && FP_PRIME == 310
-	ASSIGN_TEST(BW13_P310);
-	#endif
-
-	#if defined(EP_ENDOM) && FP_PRIME == 315
-	ASSIGN_TEST(B24_P315);
-	#endif
-	
-	#if defined(EP_ENDOM) && FP_PRIME == 381
-	ASSIGN_TEST(B12_P381);
-	#endif
-
-	#if defined(EP_ENDOM) && FP_PRIME == 446
-	ASSIGN_TEST(B12_P446);
-	#endif
-	
-	#if defined(EP_ENDOM) && FP_PRIME == 509
-	ASSIGN_TEST(B24_P509);
-	#endif	
-	
-	#if defined(EP_ENDOM) && FP_PRIME == 575
-	ASSIGN_TEST(B48_P575);
-	#endif
+/**
+ * Maximum number of distinct prime factors of the order of the auxiliary point.
+ */
+#define TATE_PRIMES		32
+
+/**
+ * Maximum number of iterations of Pollard's rho method when factoring the
+ * order of the auxiliary point.
+ */
+#define TATE_RHO		(1 << 16)
+
+/**
+ * Number of candidate x-coordinates tried when searching for an auxiliary
+ * point.
+ */
+#define TATE_TRIES		256
+
+/**
+ * Finds a nontrivial factor of a composite integer with Pollard's rho method.
+ *
+ * @param[out] d			- the factor.
+ * @param[in] m				- the integer to factor.
+ * @return 1 if a factor was found, 0 otherwise.
+ */
+static int tate_rho(bn_t d, const bn_t m) {
+	int i, r = 0;
+	dig_t c;
+	bn_t x, y, t;
+
+	bn_null(x);
+	bn_null(y);
+	bn_null(t);
+
+	RLC_TRY {
+		bn_new(x);
+		bn_new(y);
+		bn_new(t);
+
+		for (c = 1; c < 16 && !r; c++) {
+			bn_set_dig(x, 2);
+			bn_set_dig(y, 2);
+			for (i = 0; i < TATE_RHO; i++) {
+				/* Floyd's cycle finding on x -> x^2 + c mod m. */
+				bn_sqr(x, x);
+				bn_add_dig(x, x, c);
+				bn_mod(x, x, m);
+				bn_sqr(y, y);
+				bn_add_dig(y, y, c);
+				bn_mod(y, y, m);
+				bn_sqr(y, y);
+				bn_add_dig(y, y, c);
+				bn_mod(y, y, m);
+				bn_sub(t, x, y);
+				bn_abs(t, t);
+				bn_gcd(d, t, m);
+				if (bn_cmp_dig(d, 1) != RLC_EQ) {
+					/* A full cycle gives d = m, so retry with another c. */
+					r = (bn_cmp(d, m) == RLC_LT);
+					break;
+				}
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(x);
+		bn_free(y);
+		bn_free(t);
+	}
+	return r;
+}
+
+/**
+ * Computes the distinct prime factors of an integer.
+ *
+ * @param[out] l			- the prime factors, with room for TATE_PRIMES entries.
+ * @param[in] n				- the integer to factor.
+ * @return the number of prime factors, or -1 if the integer was not factored.
+ */
+static int tate_primes(bn_t *l, const bn_t n) {
+	int i, k = 0, s = 1;
+	dig_t d, r;
+	bn_t t[TATE_PRIMES];
+
+	for (i = 0; i < TATE_PRIMES; i++) {
+		bn_null(t[i]);
+	}
+
+	RLC_TRY {
+		for (i = 0; i < TATE_PRIMES; i++) {
+			bn_new(t[i]);
+		}
+
+		/* Remove small factors by trial division. */
+		bn_abs(t[0], n);
+		for (d = 2; d < 4096; d += (d == 2 ? 1 : 2)) {
+			bn_mod_dig(&r, t[0], d);
+			if (r == 0) {
+				bn_set_dig(l[k++], d);
+				do {
+					bn_div_dig(t[0], t[0], d);
+					bn_mod_dig(&r, t[0], d);
+				} while (r == 0);
+			}
+		}
+
+		/* Split the remaining factors until they are all prime. */
+		while (s > 0 && k >= 0) {
+			s--;
+			if (bn_cmp_dig(t[s], 1) == RLC_EQ) {
+				continue;
+			}
+			if (bn_is_prime(t[s])) {
+				for (i = 0; i < k && bn_cmp(l[i], t[s]) != RLC_EQ; i++);
+				if (i == k) {
+					if (k == TATE_PRIMES) {
+						k = -1;
+						break;
+					}
+					bn_copy(l[k++], t[s]);
+				}
+			} else if (s + 2 <= TATE_PRIMES && tate_rho(t[s + 1], t[s])) {
+				bn_div(t[s], t[s], t[s + 1]);
+				s += 2;
+			} else {
+				k = -1;
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; i < TATE_PRIMES; i++) {
+			bn_free(t[i]);
+		}
+	}
+	return k;
+}
+
+/**
+ * Adds a point to an intermediate point of a Miller loop in affine
+ * coordinates, accumulating the line and vertical line evaluated at another
+ * point.
+ *
+ * @param[in,out] num		- the numerator of the Miller value.
+ * @param[in,out] den		- the denominator of the Miller value.
+ * @param[in,out] t			- the intermediate point.
+ * @param[in] s				- the point to add, possibly t itself.
+ * @param[in] q				- the point where the lines are evaluated.
+ */
+static void tate_line(fp_t num, fp_t den, ep_t t, const ep_t s, const ep_t q) {
+	fp_t l, u, v;
+
+	fp_null(l);
+	fp_null(u);
+	fp_null(v);
+
+	RLC_TRY {
+		fp_new(l);
+		fp_new(u);
+		fp_new(v);
+
+		fp_sub(u, q->x, t->x);
+		fp_add(l, t->y, s->y);
+		if (fp_cmp(t->x, s->x) == RLC_EQ && (t != s || fp_is_zero(l))) {
+			/* The line through T and -T is vertical. */
+			fp_mul(num, num, u);
+			ep_set_infty(t);
+		} else {
+			if (t == s) {
+				fp_sqr(l, t->x);
+				fp_dbl(v, l);
+				fp_add(l, l, v);
+				fp_add(l, l, ep_curve_get_a());
+				fp_dbl(v, t->y);
+			} else {
+				fp_sub(l, s->y, t->y);
+				fp_sub(v, s->x, t->x);
+			}
+			fp_inv(v, v);
+			fp_mul(l, l, v);
+			/* Evaluate y - y_T - lambda * (x - x_T) at Q. */
+			fp_mul(u, u, l);
+			fp_sub(v, q->y, t->y);
+			fp_sub(v, v, u);
+			fp_mul(num, num, v);
+			/* Compute T + S and the vertical line through it. */
+			fp_sqr(u, l);
+			fp_sub(u, u, t->x);
+			fp_sub(u, u, s->x);
+			fp_sub(v, t->x, u);
+			fp_mul(v, v, l);
+			fp_sub(t->y, v, t->y);
+			fp_copy(t->x, u);
+			fp_sub(u, q->x, u);
+			fp_mul(den, den, u);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp_free(l);
+		fp_free(u);
+		fp_free(v);
+	}
+}
+
+/**
+ * Computes the reduced Weil pairing of two points of order dividing n in
+ * E(F_p), using normalized Miller functions.
+ *
+ * @param[out] w			- the result.
+ * @param[in] p				- the first point, in affine coordinates.
+ * @param[in] q				- the second point, in affine coordinates.
+ * @param[in] n				- the order.
+ * @return 1 if no line vanished during the computation, 0 otherwise.
+ */
+static int tate_weil(fp_t w, const ep_t p, const ep_t q, const bn_t n) {
+	int i, j, r = 1;
+	const ep_st *a[2] = { p, q };
+	fp_t f[2][2];
+	ep_t t;
+
+	ep_null(t);
+	for (i = 0; i < 2; i++) {
+		fp_null(f[i][0]);
+		fp_null(f[i][1]);
+	}
+
+	RLC_TRY {
+		ep_new(t);
+		for (i = 0; i < 2; i++) {
+			fp_new(f[i][0]);
+			fp_new(f[i][1]);
+		}
+
+		/* Evaluate f_{n,P} at Q and f_{n,Q} at P. */
+		for (i = 0; i < 2; i++) {
+			ep_copy(t, a[i]);
+			fp_set_dig(f[i][0], 1);
+			fp_set_dig(f[i][1], 1);
+			for (j = bn_bits(n) - 2; j >= 0 && r; j--) {
+				r = !ep_is_infty(t);
+				fp_sqr(f[i][0], f[i][0]);
+				fp_sqr(f[i][1], f[i][1]);
+				tate_line(f[i][0], f[i][1], t, t, a[1 - i]);
+				if (bn_get_bit(n, j)) {
+					r &= !ep_is_infty(t);
+					tate_line(f[i][0], f[i][1], t, a[i], a[1 - i]);
+				}
+			}
+			r &= !fp_is_zero(f[i][0]) && !fp_is_zero(f[i][1]);
+		}
+
+		if (r) {
+			/* w = (-1)^n * f_{n,P}(Q) / f_{n,Q}(P). */
+			fp_mul(f[0][0], f[0][0], f[1][1]);
+			fp_mul(f[0][1], f[0][1], f[1][0]);
+			fp_inv(f[0][1], f[0][1]);
+			fp_mul(w, f[0][0], f[0][1]);
+			if (bn_is_even(n) == 0) {
+				fp_neg(w, w);
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		ep_free(t);
+		for (i = 0; i < 2; i++) {
+			fp_free(f[i][0]);
+			fp_free(f[i][1]);
+		}
+	}
+	return r;
+}
+
+int tate_ord(bn_t e) {
+	int r = 1;
+	bn_t t;
+
+	bn_null(t);
+
+	RLC_TRY {
+		bn_new(t);
+
+		fp_prime_get_par(e);
+		switch (ep_curve_is_pairf()) {
+			case EP_BN:
+				/* Curves of prime order have nothing to test. */
+				bn_set_dig(e, 1);
+				break;
+			case EP_B12:
+			case EP_B24:
+			case EP_B48:
+				bn_sub_dig(e, e, 1);
+				bn_abs(e, e);
+				break;
+			case EP_BW13:
+			case EP_BW19:
+				bn_sqr(t, e);
+				bn_sub(e, t, e);
+				bn_add_dig(e, e, 1);
+				break;
+			default:
+				r = 0;
+				break;
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(t);
+	}
+	return r;
+}
+
+int g1_tate_find(g1_t g) {
+	int i, j, k, r = 0;
+	bn_t e, e1, n, l[TATE_PRIMES];
+	ep_t q, t;
+	fp_t u, w;
+
+	bn_null(e);
+	bn_null(e1);
+	bn_null(n);
+	ep_null(q);
+	ep_null(t);
+	fp_null(u);
+	fp_null(w);
+	for (i = 0; i < TATE_PRIMES; i++) {
+		bn_null(l[i]);
+	}
+
+	RLC_TRY {
+		bn_new(e);
+		bn_new(e1);
+		bn_new(n);
+		ep_new(q);
+		ep_new(t);
+		fp_new(u);
+		fp_new(w);
+		for (i = 0; i < TATE_PRIMES; i++) {
+			bn_new(l[i]);
+		}
+
+		g1_set_infty(g);
+		k = -1;
+		if (tate_ord(e)) {
+			if (bn_cmp_dig(e, 1) == RLC_EQ) {
+				r = 1;
+			} else {
+				k = tate_primes(l, e);
+			}
+		}
+
+		/* Try points with x = 1, 2, ... until one satisfies Lemma 1. */
+		bn_div_dig(e1, e, 3);
+		for (i = 1; i <= TATE_TRIES && k > 0 && r == 0; i++) {
+			fp_set_dig(q->x, i);
+			fp_set_dig(q->z, 1);
+			q->coord = BASIC;
+			ep_rhs(w, q);
+			if (!fp_srt(q->y, w)) {
+				continue;
+			}
+
+			/* Project to the cofactor part and check that Q has order e. */
+			ep_curve_get_ord(n);
+			ep_mul_basic(q, q, n);
+			ep_norm(q, q);
+			ep_mul_basic(t, q, e);
+			r = ep_is_infty(t);
+			for (j = 0; j < k && r; j++) {
+				bn_div(n, e, l[j]);
+				ep_mul_basic(t, q, n);
+				r = !ep_is_infty(t);
+			}
+
+			/* The Weil pairing of Q and psi(Q) must have order e/3. */
+			ep_psi(t, q);
+			r = r && tate_weil(w, q, t, e);
+			if (r) {
+				fp_exp(u, w, e1);
+				r = (fp_cmp_dig(u, 1) == RLC_EQ);
+			}
+			for (j = 0; j < k && r; j++) {
+				if (bn_is_factor(l[j], e1)) {
+					bn_div(n, e1, l[j]);
+					fp_exp(u, w, n);
+					r = (fp_cmp_dig(u, 1) != RLC_EQ);
+				}
+			}
+			if (r) {
+				ep_copy(g, q);
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(e);
+		bn_free(e1);
+		bn_free(n);
+		ep_free(q);
+		ep_free(t);
+		fp_free(u);
+		fp_free(w);
+		for (i = 0; i < TATE_PRIMES; i++) {
+			bn_free(l[i]);
+		}
+	}
+	return r;
+}
+
+int g1_tate_gen(g1_t g) {
+	char str[2 * RLC_FP_BYTES + 2];
+
+	switch (ep_param_get()) {
+#if defined(EP_ENDOM) && FP_PRIME == 286
+		case BW19_P286:
+			ASSIGN_TEST(BW19_P286);
+			break;
+#elif defined(EP_ENDOM) && FP_PRIME == 310
+		case BW13_P310:
+			ASSIGN_TEST(BW13_P310);
+			break;
+#elif defined(EP_ENDOM) && FP_PRIME == 315
+		case B24_P315:
+			ASSIGN_TEST(B24_P315);
+			break;
+#elif defined(EP_ENDOM) && FP_PRIME == 381
+		case B12_P381:
+			ASSIGN_TEST(B12_P381);
+			break;
+#elif defined(EP_ENDOM) && FP_PRIME == 446
+		case B12_P446:
+			ASSIGN_TEST(B12_P446);
+			break;
+#elif defined(EP_ENDOM) && FP_PRIME == 509
+		case B24_P509:
+			ASSIGN_TEST(B24_P509);
+			break;
+#elif defined(EP_ENDOM) && FP_PRIME == 575
+		case B48_P575:
+			ASSIGN_TEST(B48_P575);
+			break;
+#endif
+		default:
+			/* No point is recorded for this curve, so derive one. */
+			(void)str;
+			return g1_tate_find(g);
+	}
 	fp_set_dig(g->z, 1);
+	g->coord = BASIC;
+	return 1;
 }
 
 int g1_is_valid_tate(g1_t a, g1_t q) {
 	size_t r = 0;
+	g1_t t;
 
 	if (g1_is_infty(a)) {
 		return 0;
 	}
-	r = g1_on_curve(a) && test_tate(a, q);
+
+	g1_null(t);
+
+	RLC_TRY {
+		g1_new(t);
+		/* The Miller loop works on affine coordinates. */
+		g1_norm(t, a);
+		r = g1_on_curve(t) && test_tate(t, q);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		g1_free(t);
+	}
 	return r;
 }
 
 void tate_miller(fp_t N1, fp_t D1, fp_t N2, fp_t D2, g1_t q, g1_t p, g1_t p2){
-	int i, j;
-	bn_t n;
+	const ctx_t *ctx = core_get();
+	int i;
 	ep_t t;
-	ep_copy(t, q);
-	fp_t f1, g1, f2, g2;
-	int8_t s[RLC_FP_BITS + 1];
-	size_t len;
-	bn_null(n);
+	fp_t f1, g1, f2, g2, d1, d2, d3;
+
+	if (ctx->tate_len == 0) {
+		RLC_THROW(ERR_NO_VALID);
+		return;
+	}
+
 	ep_null(t);
 	fp_null(f1);
 	fp_null(g1);
 	fp_null(f2);
 	fp_null(g2);
+	fp_null(d1);
+	fp_null(d2);
+	fp_null(d3);
 	RLC_TRY {
-	bn_new(n);
-	ep_new(t);
-	fp_new(f1);
-	fp_new(g1);
-	fp_new(f2);
-	fp_new(g2);
-		switch (ep_curve_is_pairf()){
-			case EP_B12:
-			case EP_B24:
-			case EP_B48:
-				fp_prime_get_par(n);
-				bn_sub_dig(n, n, 1);
-				if(bn_sign(n) == RLC_NEG)bn_neg(n, n);	
-				bn_sub_dig(n, n, 1);	
-				len = bn_bits(n) + 1;
-				bn_rec_naf(s, &len, n, 2);
-				i = len -2; 
-				break;
-			case EP_BW13:
-				bn_t u;
-				fp_prime_get_par(n);
-				bn_sqr(u, n);
-				bn_sub(n, u, n);	
-				len = bn_bits(n) + 1;
-				bn_rec_naf(s, &len, n, 2);
-				i = len -2; 
-				break;
-		}
-		j=0;
-		if(s[0] <0 )j=1;
-		while (i>=j){
-			if(s[i] == 0 && i > j){
-				tate_qpl(f1, g1, f2, g2, t, p, p2);
-				fp_sqr(N1, N1);
-				fp_sqr(N1, N1);
-
-				fp_mul(N1, N1, f1);
-				fp_sqr(D1, D1);
-				fp_mul(D1, D1, g1);
-				fp_sqr(D1, D1);	
-			
-				fp_sqr(N2, N2);
-				fp_sqr(N2, N2);
-				fp_mul(N2, N2, f2);
-				fp_sqr(D2, D2);
-				fp_mul(D2, D2, g2);
-				fp_sqr(D2, D2);	
-				i--;
-				if(s[i] > 0){
-					tate_add(f1, g1, f2, g2, t, q, p, p2);
+		ep_new(t);
+		fp_new(f1);
+		fp_new(g1);
+		fp_new(f2);
+		fp_new(g2);
+		fp_new(d1);
+		fp_new(d2);
+		fp_new(d3);
+		/* The subtraction steps share these differences, see Eq. (7). */
+		fp_sub(d1, p->x, q->x);
+		fp_sub(d2, p2->x, q->x);
+		fp_sub(d3, p->y, q->y);
+		ep_copy(t, q);
+		for (i = 0; i < ctx->tate_len; i++) {
+			switch (ctx->tate_op[i]) {
+				case TATE_SQPL:
+					tate_qpl(f1, g1, f2, g2, t, p, p2);
+					fp_sqr(N1, N1);
+					fp_sqr(N1, N1);
 					fp_mul(N1, N1, f1);
+					fp_sqr(D1, D1);
 					fp_mul(D1, D1, g1);
+					fp_sqr(D1, D1);
+					fp_sqr(N2, N2);
+					fp_sqr(N2, N2);
 					fp_mul(N2, N2, f2);
+					fp_sqr(D2, D2);
 					fp_mul(D2, D2, g2);
-				}
-		        if(s[i] < 0){
-					tate_sub(f1, g1, f2, g2, t, q, p, p2);
+					fp_sqr(D2, D2);
+					break;
+				case TATE_SADD:
+				case TATE_SSUB:
+					if (ctx->tate_op[i] == TATE_SADD) {
+						tate_add(f1, g1, f2, g2, t, q, p, p2);
+					} else {
+						tate_sub(f1, g1, f2, g2, t, q, p, p2, d1, d2, d3);
+					}
 					fp_mul(N1, N1, f1);
-
 					fp_mul(D1, D1, g1);
 					fp_mul(N2, N2, f2);
 					fp_mul(D2, D2, g2);
-				}
-				i--;									
-			}
-			else if(s[i] == 1){	
-				tate_dba(f1, g1, f2, g2,  t, q, p, p2);
-				fp_sqr(N1, N1);
-				fp_mul(N1, N1, f1);		
-
-				fp_sqr(D1, D1);
-				fp_mul(D1, D1, g1);
-				fp_sqr(N2, N2);
-				fp_mul(N2, N2, f2);
-				fp_sqr(D2, D2);
-				fp_mul(D2, D2, g2);
-				i--;		
-			}
-			else if(s[i]==-1){	
-				tate_dbs(f1, g1, f2, g2,  t, q, p, p2);
-				fp_sqr(N1, N1);
-				fp_mul(N1, N1, f1);		
-
-				fp_sqr(D1, D1);
-				fp_mul(D1, D1, g1);
-				fp_sqr(N2, N2);
-				fp_mul(N2, N2, f2);
-				fp_sqr(D2, D2);
-				fp_mul(D2, D2, g2);
-				i--;
+					break;
+				case TATE_SDADD:
+				case TATE_SDSUB:
+				case TATE_SDBL:
+					if (ctx->tate_op[i] == TATE_SDADD) {
+						tate_dba(f1, g1, f2, g2, t, q, p, p2);
+					} else if (ctx->tate_op[i] == TATE_SDSUB) {
+						tate_dbs(f1, g1, f2, g2, t, q, p, p2, d1, d2);
+					} else {
+						tate_dbl(f1, g1, f2, g2, t, p, p2);
+					}
+					fp_sqr(N1, N1);
+					fp_mul(N1, N1, f1);
+					fp_sqr(D1, D1);
+					fp_mul(D1, D1, g1);
+					fp_sqr(N2, N2);
+					fp_mul(N2, N2, f2);
+					fp_sqr(D2, D2);
+					fp_mul(D2, D2, g2);
+					break;
+				case TATE_SDSUBL:
+					fp_sqr(f1, t->z);
+					fp_mul(g1, f1, p->x);
+					fp_sub(g1, g1, t->x);
+					fp_copy(f2, f1);
+					fp_mul(g2, f2, p2->x);
+					fp_sub(g2, g2, t->x);
+					fp_sqr(N1, N1);
+					fp_mul(N1, N1, f1);
+					fp_sqr(D1, D1);
+					fp_mul(D1, D1, g1);
+					fp_sqr(N2, N2);
+					fp_mul(N2, N2, f2);
+					fp_sqr(D2, D2);
+					fp_mul(D2, D2, g2);
+					break;
 			}
-			else{
-				tate_dbl(f1, g1, f2, g2, t, p, p2);
-				fp_sqr(N1, N1);
-				fp_mul(N1, N1, f1);			
-				fp_sqr(D1, D1);
-				fp_mul(D1, D1, g1);
-				fp_sqr(N2, N2);
-				fp_mul(N2, N2, f2);
-				fp_sqr(D2, D2);
-				fp_mul(D2, D2, g2);
-				i--;
-			}						
-		
-		}
-		if(s[0] < 0){
-			fp_sqr(f1, t->z);
-			fp_mul(g1, f1, p->x );
-			fp_sub(g1, g1, t->x);
-
-			fp_copy(f2, f1);
-			fp_mul(g2, f2, p2->x );
-			fp_sub(g2, g2, t->x);
-
-			fp_sqr(N1, N1);
-			fp_mul(N1, N1, f1);			
-			fp_sqr(D1, D1);
-			fp_mul(D1, D1, g1);
-			fp_sqr(N2, N2);
-			fp_mul(N2, N2, f2);
-			fp_sqr(D2, D2);
-			fp_mul(D2, D2, g2);	
 		}
 	}
 	RLC_CATCH_ANY {
 		RLC_THROW(ERR_CAUGHT);
 	}
 	RLC_FINALLY {
-	bn_free(n);
-	ep_free(t);
-	fp_free(f1);
-	fp_free(g1);
-	fp_free(f2);
-	fp_free(g2);
+		ep_free(t);
+		fp_free(f1);
+		fp_free(g1);
+		fp_free(f2);
+		fp_free(g2);
+		fp_free(d1);
+		fp_free(d2);
+		fp_free(d3);
 	}
 }
 
@@ -296,6 +722,11 @@ int test_tate(g1_t p, g1_t q){
 	fp_t N1, D1, N2, D2;
 	ep_t p2;
 	int r = 0;
+	if (g1_is_infty(q)) {
+		/* Only curves of prime order come without an auxiliary point. */
+		return ep_curve_is_pairf() == EP_BN;
+	}
+
 	ep_null(p2);
 	fp_null(N1);
 	fp_null(D1);
@@ -313,27 +744,18 @@ int test_tate(g1_t p, g1_t q){
 		fp_set_dig(D1, 1);
 		fp_set_dig(D2, 1);
 		tate_miller(N1, D1, N2, D2, q, p, p2);	
-		if(fp_is_zero(N1)||fp_is_zero(D1)||fp_is_zero(N2)||fp_is_zero(D2)){
-			return r;
-		}
-		else{
+		if (!fp_is_zero(N1) && !fp_is_zero(D1) && !fp_is_zero(N2) &&
+				!fp_is_zero(D2)) {
 			fp_mul(N1, N1, D2);
 			fp_mul(N2, N2, D1);
 			fp_mul(D1, D1, D2);
 			fp_inv(D1, D1);
 			fp_mul(N1, N1, D1);
 			fp_mul(N2, N2, D1);	
-			#if FP_PRIME == 315	
-				tate_exp2(N1, N1);
-				tate_exp2(N2, N2);
-				r = (fp_cmp_dig(N1,1)== RLC_EQ) && (fp_cmp_dig(N2,1)== RLC_EQ);
-			#else
-				tate_exp1(N1, D1, N1);
-				tate_exp2(N2, N2);
-				r = (fp_cmp(N1,D1)== RLC_EQ) && (fp_cmp_dig(N2,1)== RLC_EQ);
-			#endif
-			return r;
-			}
+			tate_exp1(N1, D1, N1);
+			tate_exp2(N2, N2);
+			r = (fp_cmp(N1,D1)== RLC_EQ) && (fp_cmp_dig(N2,1)== RLC_EQ);
+		}
 	}
 	RLC_CATCH_ANY {
 		RLC_THROW(ERR_CAUGHT);
@@ -345,238 +767,278 @@ int test_tate(g1_t p, g1_t q){
 		fp_free(N2);
 		fp_free(D2);
 	}
+	return r;
 }
 
 
-void miller_tab(fp_t *tab, g1_t q){
-	int i,j,k;
+/**
+ * Computes the NAF of the Miller loop parameter of the Tate-based membership
+ * test on the current curve.
+ *
+ * @param[out] s			- the NAF digits.
+ * @param[out] len			- the number of digits.
+ * @return 1 if the curve is supported, 0 otherwise.
+ */
+static int tate_naf(int8_t *s, size_t *len) {
+	int r = 0;
+	bn_t n;
+
+	bn_null(n);
+
+	RLC_TRY {
+		bn_new(n);
+
+		/* The loop runs on e - 1, the last addition gives a vertical line. */
+		if (tate_ord(n) && bn_cmp_dig(n, 1) == RLC_GT) {
+			bn_sub_dig(n, n, 1);
+			*len = bn_bits(n) + 1;
+			bn_rec_naf(s, len, n, 2);
+			r = 1;
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(n);
+	}
+	return r;
+}
+
+int tate_sched(uint8_t *op) {
 	int8_t s[RLC_FP_BITS + 1];
 	size_t len;
-	bn_t n;
+	int i, j, k = 0;
+
+	if (!tate_naf(s, &len)) {
+		return 0;
+	}
+	/* The lowest digit is handled by a final step when it is negative. */
+	j = (s[0] < 0 ? 1 : 0);
+	for (i = len - 2; i >= j; i--) {
+		if (s[i] == 0 && i > j) {
+			/* Two consecutive digits are processed by a quadrupling. */
+			op[k++] = TATE_SQPL;
+			i--;
+			if (s[i] > 0) {
+				op[k++] = TATE_SADD;
+			}
+			if (s[i] < 0) {
+				op[k++] = TATE_SSUB;
+			}
+		} else if (s[i] == 1) {
+			op[k++] = TATE_SDADD;
+		} else if (s[i] == -1) {
+			op[k++] = TATE_SDSUB;
+		} else {
+			op[k++] = TATE_SDBL;
+		}
+	}
+	if (s[0] < 0) {
+		op[k++] = TATE_SDSUBL;
+	}
+	return k;
+}
+
+void miller_tab(fp_t *tab, g1_t q){
+	const ctx_t *ctx = core_get();
+	int i, k = 0;
 	fp_t u0, u1;
-	ep_t t0,t1, _q;
-	fp_prime_get_par(n);
-	switch (ep_curve_is_pairf()){
-				case EP_B12:
-				case EP_B24:
-				case EP_B48:
-					fp_prime_get_par(n);
-					bn_sub_dig(n, n, 1);
-					if(bn_sign(n) == RLC_NEG)bn_neg(n, n);	
-					bn_sub_dig(n, n, 1);	
-					len = bn_bits(n) + 1;
-					bn_rec_naf(s, &len, n, 2);
-					i = len -2; 
+	ep_t t0, t1, _q;
+
+	if (ctx->tate_len == 0) {
+		RLC_THROW(ERR_NO_VALID);
+		return;
+	}
+
+	fp_null(u0);
+	fp_null(u1);
+	ep_null(t0);
+	ep_null(t1);
+	ep_null(_q);
+	RLC_TRY {
+		fp_new(u0);
+		fp_new(u1);
+		ep_new(t0);
+		ep_new(t1);
+		ep_new(_q);
+		ep_copy(t0, q);
+		ep_neg(_q, q);
+		for (i = 0; i < ctx->tate_len; i++) {
+			switch (ctx->tate_op[i]) {
+				case TATE_SQPL:
+					//[l_{-T}, 2T->x, 2T->y, l_{2T}]
+					fp_sqr(u0, t0->x);
+					fp_dbl(u1, u0);
+					fp_add(u0, u0, u1);
+					fp_dbl(u1, t0->y);
+					fp_inv(u1, u1);
+					fp_neg(u1, u1);
+					fp_mul(tab[k], u0, u1);
+					ep_dbl_basic(t0, t0);
+					fp_sqr(u0, t0->x);
+					fp_dbl(u1, u0);
+					fp_add(u0, u0, u1);
+					fp_dbl(u1, t0->y);
+					fp_inv(u1, u1);
+					fp_copy(tab[k+1], t0->x);
+					fp_copy(tab[k+2], t0->y);
+					fp_mul(tab[k+3], u0, u1);
+					ep_dbl_basic(t0, t0);
+					k = k + 4;
 					break;
-				case EP_BW13:
-					bn_t u;
-					fp_prime_get_par(n);
-					bn_sqr(u, n);
-					bn_sub(n, u, n);	
-					len = bn_bits(n) + 1;
-					bn_rec_naf(s, &len, n, 2);
-					i = len -2; 
+				case TATE_SADD:
+					//[l_{T+q}, T->x]
+					fp_sub(u0, t0->y, q->y);
+					fp_sub(u1, t0->x, q->x);
+					fp_inv(u1, u1);
+					fp_mul(tab[k], u0, u1);
+					fp_copy(tab[k+1], t0->x);
+					k = k + 2;
+					ep_add_basic(t0, t0, q);
+					break;
+				case TATE_SSUB:
+					//[l_{T-q}, (T-q)->x]
+					fp_add(u0, t0->y, q->y);
+					fp_sub(u1, q->x, t0->x);
+					fp_inv(u1, u1);
+					fp_mul(tab[k], u0, u1);
+					ep_add_basic(t0, t0, _q);
+					fp_copy(tab[k+1], t0->x);
+					k = k + 2;
+					break;
+				case TATE_SDADD:
+				case TATE_SDSUB:
+					fp_copy(tab[k], t0->x);
+					fp_copy(tab[k+1], t0->y);
+					if (ctx->tate_op[i] == TATE_SDADD) {
+						fp_sub(u0, t0->y, q->y);
+						fp_sub(u1, t0->x, q->x);
+						fp_inv(tab[k+2], u1);
+						fp_mul(tab[k+2],tab[k+2],u0);//lambda_T,P
+						ep_add_basic(t1, t0, q);
+					} else {
+						fp_add(u0, t0->y, q->y);
+						fp_sub(u1, t0->x, q->x);
+						fp_inv(tab[k+2], u1);
+						fp_mul(tab[k+2],tab[k+2],u0);//lambda_T,-P
+						ep_sub(t1, t0, q);
+						ep_norm(t1, t1);
+					}
+					fp_sub(u0, t1->y, t0->y);
+					fp_sub(u1, t1->x, t0->x);
+					fp_inv(tab[k+3], u1);
+					fp_mul(tab[k+3],tab[k+3],u0);//lambda_T+P,T
+
+					fp_mul(u0, tab[k+2], tab[k+3]);
+					fp_add(tab[k+3], tab[k+2], tab[k+3]);
+					fp_add(tab[k+2], u0, t0->x);
+					fp_add(tab[k+2], tab[k+2], t1->x);
+					ep_add_basic(t0, t1, t0);
+					k = k + 4;
+					break;
+				case TATE_SDBL:
+					//[l_{-T，-T}， 2T->x, 2T->y]
+					fp_sqr(u0, t0->x);
+					fp_dbl(u1, u0);
+					fp_add(u0, u0, u1);
+					fp_dbl(u1, t0->y);
+					fp_inv(u1, u1);
+					fp_neg(u1, u1);
+					fp_mul(tab[k], u0, u1);
+					ep_dbl_basic(t0, t0);
+					fp_copy(tab[k+1], t0->x);
+					fp_copy(tab[k+2], t0->y);
+					k = k + 3;
+					break;
+				case TATE_SDSUBL:
+					fp_copy(tab[k], t0->x);
+					k = k + 1;
 					break;
 			}
-	j=0;k=0;
-	ep_copy(t0, q);
-	ep_neg(_q, q);
-	if(s[0] <0 )j=1;
-	while (i>=j){
-		if(s[i] == 0 && i > j){
-			fp_sqr(u0, t0->x);
-			fp_dbl(u1, u0);
-			fp_add(u0, u0, u1);
-			fp_dbl(u1, t0->y);
-			fp_inv(u1, u1);
-			fp_neg(u1, u1);
-			fp_mul(tab[k], u0, u1);
-			ep_dbl_basic(t0, t0);
-			fp_sqr(u0, t0->x);
-			fp_dbl(u1, u0);
-			fp_add(u0, u0, u1);
-			fp_dbl(u1, t0->y);
-			fp_inv(u1, u1);
-			fp_copy(tab[k+1], t0->x);
-			fp_copy(tab[k+2], t0->y);
-			fp_mul(tab[k+3], u0, u1);
-			ep_dbl_basic(t0, t0);
-			k=k+4;
-			i--;
-			//[l_{-T}, 2T->x, 2T->y, l_{2T}]
-			if(s[i] > 0){
-				fp_sub(u0, t0->y, q->y);
-				fp_sub(u1, t0->x, q->x);
-				fp_inv(u1, u1);
-				fp_mul(tab[k], u0, u1);
-				fp_copy(tab[k+1], t0->x);
-				k=k+2;
-				ep_add_basic(t0, t0, q);
-
-				//[l_{T+q}, T->x]	
-			}
-		    if(s[i] < 0){
-				fp_add(u0, t0->y, q->y);
-				fp_sub(u1, q->x, t0->x);
-				fp_inv(u1, u1);
-				fp_mul(tab[k], u0, u1);
-				ep_add_basic(t0, t0, _q);	
-				fp_copy(tab[k+1], t0->x);
-				k=k+2;
-				//[l_{T-q}, (T-q)->x]	
-			}
-			i--;									
-		}
-		else if(s[i] == 1){	
-			fp_copy(tab[k], t0->x);
-			fp_copy(tab[k+1], t0->y);
-			fp_sub(u0, t0->y, q->y);
-			fp_sub(u1, t0->x, q->x);
-			fp_inv(tab[k+2], u1);
-			fp_mul(tab[k+2],tab[k+2],u0);//lambda_T,P
-
-			ep_add_basic(t1, t0, q);	
-			fp_sub(u0, t1->y, t0->y);
-			fp_sub(u1, t1->x, t0->x);
-			fp_inv(tab[k+3], u1);
-			fp_mul(tab[k+3],tab[k+3],u0);//lambda_T+P,T	
-
-			fp_mul(u0, tab[k+2], tab[k+3]);
-			fp_add(tab[k+3], tab[k+2], tab[k+3]);
-			fp_add(tab[k+2], u0, t0->x);
-			fp_add(tab[k+2], tab[k+2], t1->x);
-			ep_add_basic(t0, t1, t0);
-			k=k+4;
-			i--;	
-		}
-		else if(s[i]==-1){	
-			fp_copy(tab[k], t0->x);
-			fp_copy(tab[k+1], t0->y);
-			fp_add(u0, t0->y, q->y);
-			fp_sub(u1, t0->x, q->x);
-			fp_inv(tab[k+2], u1);
-			fp_mul(tab[k+2],tab[k+2],u0);//lambda_T,-P
-
-			ep_sub(t1, t0, q);	
-			ep_norm(t1, t1);
-			fp_sub(u0, t1->y, t0->y);
-			fp_sub(u1, t1->x, t0->x);
-			fp_inv(tab[k+3], u1);
-			fp_mul(tab[k+3],tab[k+3],u0);//lambda_T-P,T	
-
-			fp_mul(u0, tab[k+2], tab[k+3]);
-			fp_add(tab[k+3], tab[k+2], tab[k+3]);
-			fp_add(tab[k+2], u0, t0->x);
-			fp_add(tab[k+2], tab[k+2], t1->x);
-			ep_add_basic(t0, t1, t0);
-			k=k+4;
-			i--;			
-
-		}
-		else{
-			fp_sqr(u0, t0->x);
-			fp_dbl(u1, u0);
-			fp_add(u0, u0, u1);
-			fp_dbl(u1, t0->y);
-			fp_inv(u1, u1);
-			fp_neg(u1, u1);
-			fp_mul(tab[k], u0, u1);
-			ep_dbl_basic(t0, t0);
-			fp_copy(tab[k+1], t0->x);
-			fp_copy(tab[k+2], t0->y);	
-			i--;
-			k=k+3;
-			//[l_{-T，-T}， 2T->x, 2T->y]
-		}						
-		
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp_free(u0);
+		fp_free(u1);
+		ep_free(t0);
+		ep_free(t1);
+		ep_free(_q);
 	}
-	if(s[0] < 0)fp_copy(tab[k], t0->x);	
 }
 
 void tate_miller_pre(fp_t *tab, fp_t N1, fp_t D1, fp_t N2, fp_t D2, g1_t q, g1_t p, g1_t p2){
-	int i, j, k;
-	bn_t n;
-	ep_t t;
-	ep_copy(t, q);
+	const ctx_t *ctx = core_get();
+	int i, k = 0;
 	fp_t f1, g1, f2, g2, u0, u1, u2, u3;
 	dv_t v0, v1, v2;
-	int8_t s[RLC_FP_BITS + 1];
-	size_t len;
-	bn_null(n);
-	ep_null(t);
+
+	if (ctx->tate_len == 0) {
+		RLC_THROW(ERR_NO_VALID);
+		return;
+	}
+
 	fp_null(f1);
 	fp_null(g1);
 	fp_null(f2);
 	fp_null(g2);
+	fp_null(u0);
+	fp_null(u1);
+	fp_null(u2);
+	fp_null(u3);
+	dv_null(v0);
+	dv_null(v1);
+	dv_null(v2);
 	RLC_TRY {
-	bn_new(n);
-	ep_new(t);
-	fp_new(f1);
-	fp_new(g1);
-	fp_new(f2);
-	fp_new(g2);
-		switch (ep_curve_is_pairf()){
-			case EP_B12:
-			case EP_B24:
-			case EP_B48:
-				fp_prime_get_par(n);
-				bn_sub_dig(n, n, 1);
-				if(bn_sign(n) == RLC_NEG)bn_neg(n, n);	
-				bn_sub_dig(n, n, 1);	
-				len = bn_bits(n) + 1;
-				bn_rec_naf(s, &len, n, 2);
-				i = len-2; 
-				break;
-			case EP_BW13:
-				bn_t u;
-				fp_prime_get_par(n);
-				bn_sqr(u, n);
-				bn_sub(n, u, n);	
-				len = bn_bits(n) + 1;
-				bn_rec_naf(s, &len, n, 2);
-				i = len -2; 
-				break;
-		}
-		j=0;k=0;
-		if(s[0] < 0)j=1;
+		fp_new(f1);
+		fp_new(g1);
+		fp_new(f2);
+		fp_new(g2);
+		fp_new(u0);
+		fp_new(u1);
+		fp_new(u2);
+		fp_new(u3);
+		dv_new(v0);
+		dv_new(v1);
+		dv_new(v2);
 		fp_sub(u1, p->y, q->y);//d3
 		fp_sub(u2, p->x, q->x);//d1
 		fp_sub(u3, p2->x, q->x);//d2
-		while (i>=j){
-			if(s[i] == 0 && i > j){
-				fp_sub(u0, p->y, tab[k+2]);
-				fp_sub(f1, p->x, tab[k+1]);
-				fp_sub(f2, p2->x, tab[k+1]);				
-				fp_mul(g1, f1, tab[k]);
-				fp_sub(g1, u0, g1);
-				fp_mul(g2, f2, tab[k]);
-				fp_sub(g2, u0, g2);	
-				
-				fp_mul(f1, f1, tab[k+3]);
-				fp_sub(f1, u0, f1);
-				fp_mul(f2, f2, tab[k+3]);
-				fp_sub(f2, u0, f2);
-
-
-
-				fp_sqr(N1, N1);
-				fp_sqr(N1, N1);
-
-				fp_mul(N1, N1, f1);
-				fp_sqr(D1, D1);
-				fp_mul(D1, D1, g1);
-				fp_sqr(D1, D1);	
-			
-				fp_sqr(N2, N2);
-				fp_sqr(N2, N2);
-				fp_mul(N2, N2, f2);
-				fp_sqr(D2, D2);
-				fp_mul(D2, D2, g2);
-				fp_sqr(D2, D2);	
-				k=k+4;
-				i--;
-				if(s[i] > 0){
-					
+		for (i = 0; i < ctx->tate_len; i++) {
+			switch (ctx->tate_op[i]) {
+				case TATE_SQPL:
+					fp_sub(u0, p->y, tab[k+2]);
+					fp_sub(f1, p->x, tab[k+1]);
+					fp_sub(f2, p2->x, tab[k+1]);
+					fp_mul(g1, f1, tab[k]);
+					fp_sub(g1, u0, g1);
+					fp_mul(g2, f2, tab[k]);
+					fp_sub(g2, u0, g2);
+
+					fp_mul(f1, f1, tab[k+3]);
+					fp_sub(f1, u0, f1);
+					fp_mul(f2, f2, tab[k+3]);
+					fp_sub(f2, u0, f2);
+
+					fp_sqr(N1, N1);
+					fp_sqr(N1, N1);
+					fp_mul(N1, N1, f1);
+					fp_sqr(D1, D1);
+					fp_mul(D1, D1, g1);
+					fp_sqr(D1, D1);
+
+					fp_sqr(N2, N2);
+					fp_sqr(N2, N2);
+					fp_mul(N2, N2, f2);
+					fp_sqr(D2, D2);
+					fp_mul(D2, D2, g2);
+					fp_sqr(D2, D2);
+					k = k + 4;
+					break;
+				case TATE_SADD:
 					fp_mul(f1, tab[k], u2);
 					fp_sub(f1, u1, f1);
 					fp_mul(f2, tab[k], u3);
@@ -586,126 +1048,101 @@ void tate_miller_pre(fp_t *tab, fp_t N1, fp_t D1, fp_t N2, fp_t D2, g1_t q, g1_t
 
 					fp_mul(N1, N1, f1);
 					fp_mul(D1, D1, g1);
-					fp_mul(N2, N2, f2);	
+					fp_mul(N2, N2, f2);
 					fp_mul(D2, D2, g2);
-					k=k+2;
-
-				}
-		        if(s[i] < 0){
+					k = k + 2;
+					break;
+				case TATE_SSUB:
 					fp_sub(f1, p->x, tab[k+1]);
 					fp_sub(f2, p2->x, tab[k+1]);
 					fp_mul(g1, tab[k], u2);
 					fp_sub(g1, u1, g1);
 					fp_mul(g2, tab[k], u3);
-					fp_sub(g2, u1, g2);	
+					fp_sub(g2, u1, g2);
 
 					fp_mul(N1, N1, f1);
 					fp_mul(D1, D1, g1);
 					fp_mul(N2, N2, f2);
 					fp_mul(D2, D2, g2);
+					k = k + 2;
+					break;
+				case TATE_SDADD:
+				case TATE_SDSUB:
+					fp_sub(u0, p->x, tab[k]);
+					fp_sub(g1, p2->x, tab[k]);
+					fp_add(g2, p->x, tab[k+2]);
+					fp_add(f1, p2->x, tab[k+2]);
+					fp_muln_low(v0, u0, g2);
+					fp_muln_low(v1, g1, f1);
+					fp_sub(g2, p->y, tab[k+1]);
+					fp_muln_low(v2, g2, tab[k+3]);
+					fp_subc_low(v0, v0, v2);
+					fp_subc_low(v1, v1, v2);
+					fp_rdc(f1, v0);
+					fp_rdc(f2, v1);
 
-					k=k+2;
-				}
-				i--;									
-			}
-			else if(s[i] == 1){	
-				fp_sub(u0, p->x, tab[k]);
-				fp_sub(g1, p2->x, tab[k]);
-				fp_add(g2, p->x, tab[k+2]);
-				fp_add(f1, p2->x, tab[k+2]);
-				fp_muln_low(v0, u0, g2);
-				fp_muln_low(v1, g1, f1);
-				fp_sub(g2, p->y, tab[k+1]);
-				fp_muln_low(v2, g2, tab[k+3]);
-				fp_subc_low(v0, v0, v2);
-				fp_subc_low(v1, v1, v2);
-				fp_rdc(f1, v0);
-				fp_rdc(f2, v1);
-
-				fp_sqr(N1, N1);
-				fp_mul(N1, N1, f1);		
-				fp_mul(D1, D1, u0);
-				fp_sqr(D1, D1);
-
-				fp_sqr(N2, N2);
-				fp_mul(N2, N2, f2);
-				fp_mul(D2, D2, g1);
-				fp_sqr(D2, D2);
-				k=k+4;
-				i--;							
-			}
-			else if(s[i]==-1){	
-				fp_sub(u0, p->x, tab[k]);
-				fp_sub(g1, p2->x, tab[k]);
-				fp_add(g2, p->x, tab[k+2]);
-				fp_add(f1, p2->x, tab[k+2]);
-				fp_muln_low(v0, u0, g2);
-				fp_muln_low(v1, g1, f1);
-				fp_sub(g2, p->y, tab[k+1]);
-				fp_muln_low(v2, g2, tab[k+3]);
-				fp_subc_low(v0, v0, v2);
-				fp_subc_low(v1, v1, v2);
-				fp_rdc(f1, v0);
-				fp_rdc(f2, v1);
-
-				fp_sqr(N1, N1);
-				fp_mul(N1, N1, f1);		
-				fp_mul(D1, D1, u0);
-				fp_sqr(D1, D1);
-				fp_mul(D1, D1, u2);
-
-				fp_sqr(N2, N2);
-				fp_mul(N2, N2, f2);
-				fp_mul(D2, D2, g1);
-				fp_sqr(D2, D2);
-				fp_mul(D2, D2, u3);
-				k=k+4;
-				i--;				
+					fp_sqr(N1, N1);
+					fp_mul(N1, N1, f1);
+					fp_mul(D1, D1, u0);
+					fp_sqr(D1, D1);
+
+					fp_sqr(N2, N2);
+					fp_mul(N2, N2, f2);
+					fp_mul(D2, D2, g1);
+					fp_sqr(D2, D2);
+					if (ctx->tate_op[i] == TATE_SDSUB) {
+						fp_mul(D1, D1, u2);
+						fp_mul(D2, D2, u3);
+					}
+					k = k + 4;
+					break;
+				case TATE_SDBL:
+					fp_sub(f1, p->x, tab[k+1]);
+					fp_sub(f2, p2->x, tab[k+1]);
+
+					fp_sub(u0, p->y, tab[k+2]);
+					fp_mul(g1, tab[k], f1);
+					fp_sub(g1, u0, g1);
+					fp_mul(g2, tab[k], f2);
+					fp_sub(g2, u0, g2);
+					fp_sqr(N1, N1);
+					fp_mul(N1, N1, f1);
+					fp_sqr(D1, D1);
+					fp_mul(D1, D1, g1);
+					fp_sqr(N2, N2);
+					fp_mul(N2, N2, f2);
+					fp_sqr(D2, D2);
+					fp_mul(D2, D2, g2);
+					k = k + 3;
+					break;
+				case TATE_SDSUBL:
+					fp_sub(g1, p->x, tab[k]);
+					fp_sub(g2, p2->x, tab[k]);
+					fp_sqr(N1, N1);
+					fp_sqr(D1, D1);
+					fp_mul(D1, D1, g1);
+					fp_sqr(N2, N2);
+					fp_sqr(D2, D2);
+					fp_mul(D2, D2, g2);
+					break;
 			}
-			else{
-				fp_sub(f1, p->x, tab[k+1]);
-				fp_sub(f2, p2->x, tab[k+1]);
-				
-				fp_sub(u0, p->y, tab[k+2]);
-				fp_mul(g1, tab[k], f1);
-				fp_sub(g1, u0, g1);
-				fp_mul(g2, tab[k], f2);
-				fp_sub(g2, u0, g2);				
-				fp_sqr(N1, N1);
-				fp_mul(N1, N1, f1);			
-				fp_sqr(D1, D1);
-				fp_mul(D1, D1, g1);
-				fp_sqr(N2, N2);
-				fp_mul(N2, N2, f2);
-				fp_sqr(D2, D2);
-				fp_mul(D2, D2, g2);
-				k=k+3;
-				i--;
-			}						
-		
-		}
-		if(s[0] < 0){
-			
-			fp_sub(g1, p->x, tab[k]);
-			fp_sub(g2, p2->x, tab[k]);
-			fp_sqr(N1, N1);
-			fp_sqr(D1, D1);
-			fp_mul(D1, D1, g1);
-			fp_sqr(N2, N2);
-			fp_sqr(D2, D2);
-			fp_mul(D2, D2, g2);	
 		}
 	}
 	RLC_CATCH_ANY {
 		RLC_THROW(ERR_CAUGHT);
 	}
 	RLC_FINALLY {
-	bn_free(n);
-	ep_free(t);
-	fp_free(f1);
-	fp_free(g1);
-	fp_free(f2);
-	fp_free(g2);
+		fp_free(f1);
+		fp_free(g1);
+		fp_free(f2);
+		fp_free(g2);
+		fp_free(u0);
+		fp_free(u1);
+		fp_free(u2);
+		fp_free(u3);
+		dv_free(v0);
+		dv_free(v1);
+		dv_free(v2);
 	}
 }
 
@@ -713,6 +1150,11 @@ int test_tate_pre(g1_t p, g1_t q, fp_t *tab){
 	fp_t N1, D1, N2, D2;
 	ep_t p2;
 	int r = 0;
+	if (g1_is_infty(q)) {
+		/* Only curves of prime order come without an auxiliary point. */
+		return ep_curve_is_pairf() == EP_BN;
+	}
+
 	ep_null(p2);
 	fp_null(N1);
 	fp_null(D1);
@@ -729,11 +1171,9 @@ int test_tate_pre(g1_t p, g1_t q, fp_t *tab){
 		fp_sub(N2, p2->x, q->x);
 		fp_set_dig(D1, 1);
 		fp_set_dig(D2, 1);
-		tate_miller_pre(tab, N1, D1,N2, D2, q, p, p2);
-		if(fp_is_zero(N1)||fp_is_zero(D1)||fp_is_zero(N2)||fp_is_zero(D2)){
-			return r;
-		}
-		else{
+		tate_miller_vec(tab, N1, D1,N2, D2, q, p, p2);
+		if (!fp_is_zero(N1) && !fp_is_zero(D1) && !fp_is_zero(N2) &&
+				!fp_is_zero(D2)) {
 			fp_mul(N1, N1, D2);
 			fp_mul(N2, N2, D1);
 			fp_mul(D1, D1, D2);
@@ -743,8 +1183,7 @@ int test_tate_pre(g1_t p, g1_t q, fp_t *tab){
 			tate_exp1(N1, D1, N1);
 			tate_exp2(N2, N2);
 			r = (fp_cmp(N1,D1)== RLC_EQ) && (fp_cmp_dig(N2,1)== RLC_EQ);
-			return r;
-			}
+		}
 	}
 	RLC_CATCH_ANY {
 		RLC_THROW(ERR_CAUGHT);
@@ -756,14 +1195,328 @@ int test_tate_pre(g1_t p, g1_t q, fp_t *tab){
 		fp_free(N2);
 		fp_free(D2);
 	}
+	return r;
 }
 
 int g1_is_valid_tate_pre(g1_t a, g1_t q, fp_t* tab) {
 	size_t r = 0;
+	g1_t t;
 
 	if (g1_is_infty(a)) {
 		return 0;
 	}
-	r = g1_on_curve(a) && test_tate_pre(a, q, tab);
+
+	g1_null(t);
+
+	RLC_TRY {
+		g1_new(t);
+		/* The Miller loop works on affine coordinates. */
+		g1_norm(t, a);
+		r = g1_on_curve(t) && test_tate_pre(t, q, tab);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		g1_free(t);
+	}
 	return r;
-}
\ No newline at end of file
+}
+/**
+ * Checks a set of inverted Miller values from the batched Tate membership
+ * test, combining them with random exponents and bisecting on failure.
+ *
+ * @param[out] res			- the validity flags indexed by the original points.
+ * @param[in] idx			- the original index of each Miller value.
+ * @param[in] f1			- the Miller values of the first Tate pairing.
+ * @param[in] f2			- the Miller values of the second Tate pairing.
+ * @param[in] n				- the number of Miller values.
+ */
+static void tate_batch(int *res, const int *idx, fp_t *f1, fp_t *f2, int n) {
+	int i, j, r = 0;
+	uint64_t *k = RLC_ALLOCA(uint64_t, n);
+	uint8_t buf[sizeof(uint64_t)];
+	bn_t e, g, t;
+	fp_t a, c, u1, u2;
+
+	bn_null(e);
+	bn_null(g);
+	bn_null(t);
+	fp_null(a);
+	fp_null(c);
+	fp_null(u1);
+	fp_null(u2);
+
+	RLC_TRY {
+		if (k == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		bn_new(e);
+		bn_new(g);
+		bn_new(t);
+		fp_new(a);
+		fp_new(c);
+		fp_new(u1);
+		fp_new(u2);
+
+		if (n == 1) {
+			/* A single point is checked exactly. */
+			fp_copy(u1, f1[0]);
+			fp_copy(u2, f2[0]);
+		} else {
+			/* Compute u1 = \prod f1[i]^k[i] and u2 = \prod f2[i]^k[i] with
+			 * shared squarings, for random 64-bit exponents k[i]. Taking k[i]
+			 * coprime to e means a single invalid point is never cancelled. */
+			rand_bytes((uint8_t *)k, n * sizeof(uint64_t));
+			if (tate_ord(e) && bn_cmp_dig(e, 1) == RLC_GT) {
+				for (i = 0; i < n; i++) {
+					do {
+						for (j = 0; j < (int)sizeof(uint64_t); j++) {
+							buf[sizeof(uint64_t) - 1 - j] = (uint8_t)(k[i] >> (8 * j));
+						}
+						bn_read_bin(t, buf, sizeof(uint64_t));
+						bn_gcd(g, t, e);
+						if (bn_cmp_dig(g, 1) != RLC_EQ) {
+							rand_bytes((uint8_t *)&k[i], sizeof(uint64_t));
+						}
+					} while (bn_cmp_dig(g, 1) != RLC_EQ);
+				}
+			}
+			fp_set_dig(u1, 1);
+			fp_set_dig(u2, 1);
+			for (j = RLC_TATE_BATCH - 1; j >= 0; j--) {
+				fp_sqr(u1, u1);
+				fp_sqr(u2, u2);
+				for (i = 0; i < n; i++) {
+					if ((k[i] >> j) & 1) {
+						fp_mul(u1, u1, f1[i]);
+						fp_mul(u2, u2, f2[i]);
+					}
+				}
+			}
+		}
+
+		tate_exp1(a, c, u1);
+		tate_exp2(u2, u2);
+		r = (fp_cmp(a, c) == RLC_EQ) && (fp_cmp_dig(u2, 1) == RLC_EQ);
+
+		if (r) {
+			for (i = 0; i < n; i++) {
+				res[idx[i]] = 1;
+			}
+		} else if (n > 1) {
+			/* Bisect to locate the invalid points. */
+			tate_batch(res, idx, f1, f2, n / 2);
+			tate_batch(res, idx + n / 2, f1 + n / 2, f2 + n / 2, n - n / 2);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(e);
+		bn_free(g);
+		bn_free(t);
+		fp_free(a);
+		fp_free(c);
+		fp_free(u1);
+		fp_free(u2);
+		RLC_FREE(k);
+	}
+}
+
+int g1_is_valid_tate_batch(int *res, const g1_t *a, int n, g1_t q) {
+	int i, m = 0, r = 1;
+	int *idx = RLC_ALLOCA(int, n);
+	fp_t N1, D1, N2, D2, *f1 = RLC_ALLOCA(fp_t, n), *f2 = RLC_ALLOCA(fp_t, n);
+	fp_t *d = RLC_ALLOCA(fp_t, n);
+	g1_t p, p2;
+
+	if (n <= 0) {
+		RLC_FREE(idx);
+		RLC_FREE(f1);
+		RLC_FREE(f2);
+		RLC_FREE(d);
+		return 1;
+	}
+
+	fp_null(N1);
+	fp_null(D1);
+	fp_null(N2);
+	fp_null(D2);
+	g1_null(p);
+	g1_null(p2);
+
+	RLC_TRY {
+		if (idx == NULL || f1 == NULL || f2 == NULL || d == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < n; i++) {
+			fp_null(f1[i]);
+			fp_null(f2[i]);
+			fp_null(d[i]);
+			fp_new(f1[i]);
+			fp_new(f2[i]);
+			fp_new(d[i]);
+		}
+		fp_new(N1);
+		fp_new(D1);
+		fp_new(N2);
+		fp_new(D2);
+		g1_new(p);
+		g1_new(p2);
+
+		/* Run the shared Miller loop for each candidate point. */
+		for (i = 0; i < n; i++) {
+			res[i] = 0;
+			if (g1_is_infty(a[i]) || !g1_on_curve(a[i])) {
+				continue;
+			}
+			g1_norm(p, a[i]);
+			ep_psi(p2, p);
+			fp_sub(N1, p->x, q->x);
+			fp_sub(N2, p2->x, q->x);
+			fp_set_dig(D1, 1);
+			fp_set_dig(D2, 1);
+			tate_miller(N1, D1, N2, D2, q, p, p2);
+			if (fp_is_zero(N1) || fp_is_zero(D1) || fp_is_zero(N2) ||
+					fp_is_zero(D2)) {
+				continue;
+			}
+			fp_mul(f1[m], N1, D2);
+			fp_mul(f2[m], N2, D1);
+			fp_mul(d[m], D1, D2);
+			idx[m++] = i;
+		}
+
+		if (m > 0) {
+			/* Share a single inversion among all Miller values. */
+			fp_inv_sim(d, (const fp_t *)d, m);
+			for (i = 0; i < m; i++) {
+				fp_mul(f1[i], f1[i], d[i]);
+				fp_mul(f2[i], f2[i], d[i]);
+			}
+			tate_batch(res, idx, f1, f2, m);
+		}
+
+		for (i = 0; i < n; i++) {
+			r &= res[i];
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; i < n; i++) {
+			fp_free(f1[i]);
+			fp_free(f2[i]);
+			fp_free(d[i]);
+		}
+		fp_free(N1);
+		fp_free(D1);
+		fp_free(N2);
+		fp_free(D2);
+		g1_free(p);
+		g1_free(p2);
+		RLC_FREE(idx);
+		RLC_FREE(f1);
+		RLC_FREE(f2);
+		RLC_FREE(d);
+	}
+	return r;
+}
+
+int tate_tab_len(void) {
+	const ctx_t *ctx = core_get();
+	int i, k = 0;
+
+	for (i = 0; i < ctx->tate_len; i++) {
+		switch (ctx->tate_op[i]) {
+			case TATE_SQPL:
+			case TATE_SDADD:
+			case TATE_SDSUB:
+				k += 4;
+				break;
+			case TATE_SDBL:
+				k += 3;
+				break;
+			case TATE_SADD:
+			case TATE_SSUB:
+				k += 2;
+				break;
+			case TATE_SDSUBL:
+				k += 1;
+				break;
+		}
+	}
+	return k;
+}
+
+void tate_tab_make(tate_tab_t t, g1_t q) {
+	int i, len = tate_tab_len();
+
+	tate_tab_free(t);
+	if (len == 0) {
+		RLC_THROW(ERR_NO_VALID);
+		return;
+	}
+
+	t->tab = (fp_t *)malloc(len * sizeof(fp_t));
+	if (t->tab == NULL) {
+		RLC_THROW(ERR_NO_MEMORY);
+		return;
+	}
+	for (i = 0; i < len; i++) {
+		fp_null(t->tab[i]);
+	}
+	t->len = len;
+
+	RLC_TRY {
+		for (i = 0; i < len; i++) {
+			fp_new(t->tab[i]);
+		}
+		miller_tab(t->tab, q);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+}
+
+void tate_tab_free(tate_tab_t t) {
+	int i;
+
+	if (t->tab != NULL) {
+		for (i = 0; i < t->len; i++) {
+			fp_free(t->tab[i]);
+		}
+		free(t->tab);
+	}
+	t->tab = NULL;
+	t->len = 0;
+}
+
+void g1_tate_get(g1_t q) {
+	g1_copy(q, &(core_get()->tate_q));
+}
+
+const tate_tab_st *g1_tate_get_tab(void) {
+	ctx_t *ctx = core_get();
+
+	if (ctx->tate_tab.tab == NULL) {
+		return NULL;
+	}
+	return &(ctx->tate_tab);
+}
+
+int g1_is_valid_tate_ctx(g1_t a) {
+	ctx_t *ctx = core_get();
+
+	if (ctx->tate_tab.tab == NULL) {
+		if (ep_curve_is_pairf() == EP_BN) {
+			return g1_is_valid_tate(a, &(ctx->tate_q));
+		}
+		RLC_THROW(ERR_NO_VALID);
+		return 0;
+	}
+	return g1_is_valid_tate_pre(a, &(ctx->tate_q), ctx->tate_tab.tab);
+}
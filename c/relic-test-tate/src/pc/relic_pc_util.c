@@ -67,6 +67,21 @@ void gt_get_gen(gt_t g) {
 }
 
 int g1_is_valid(const g1_t a) {
+	if (g1_is_infty(a)) {
+		return 0;
+	}
+
+#if PC_SMT == TATE
+	/* Use the precomputed Tate test whenever the curve supports it. */
+	if (g1_tate_get_tab() != NULL) {
+		return g1_is_valid_tate_ctx((ep_st *)a);
+	}
+#endif
+
+	return g1_is_valid_endom(a);
+}
+
+int g1_is_valid_endom(const g1_t a) {
 	bn_t n, t;
 	g1_t u, v;
 	size_t l0, l1, r = 0;
@@ -93,7 +108,12 @@ int g1_is_valid(const g1_t a) {
 			r = g1_on_curve(a);
 		} else {
 			fp_prime_get_par(n);
+#if PC_SMT == ORDER
+			/* Skip the endomorphism-based formulas and check the order. */
+			switch (0) {
+#else
 			switch (ep_curve_is_pairf()) {
+#endif
 				/* Formulas from "Co-factor clearing and subgroup membership
 				 * testing on pairing-friendly curves" by El Housni, Guillevic,
 				 * Piellard. https://eprint.iacr.org/2022/352.pdf */
@@ -101,19 +121,19 @@ int g1_is_valid(const g1_t a) {
 				case EP_B24:
 				case EP_B48:
 					/* Check [\psi^2(P) == [-z^2]P. */
-					g1_mul_any(u, a, n);
-					g1_mul_any(u, u, n);
+					ep_mul_z(u, a);
+					ep_mul_z(u, u);
 					if (ep_curve_is_pairf() == EP_B24) {
 						/* Check [\psi^2(P) == [-z^4]P. */
-						g1_mul_any(u, u, n);
-						g1_mul_any(u, u, n);
+						ep_mul_z(u, u);
+						ep_mul_z(u, u);
 					}
 					if (ep_curve_is_pairf() == EP_B48) {
 						/* Check [\psi^2(P) == [-z^8]P. */
-						g1_mul_any(u, u, n);
-						g1_mul_any(u, u, n);
-						g1_mul_any(u, u, n);
-						g1_mul_any(u, u, n);
+						ep_mul_z(u, u);
+						ep_mul_z(u, u);
+						ep_mul_z(u, u);
+						ep_mul_z(u, u);
 					}
 					g1_neg(u, u);
 					ep_psi(v, a);
@@ -156,6 +176,13 @@ int g1_is_valid(const g1_t a) {
 					}
 					r = g1_on_curve(a) && g1_is_infty(u);
 					break;
+				case EP_BW19:
+					/* The GLV method gives [r]P = O for any P on this curve,
+					 * so check the order without the endomorphism. */
+					pc_get_ord(n);
+					g1_mul_any(u, a, n);
+					r = g1_on_curve(a) && g1_is_infty(u);
+					break;
 				default:
 					pc_get_ord(n);
 					bn_sub_dig(n, n, 1);
@@ -407,35 +434,21 @@ int g2_is_valid_bn(const g2_t a) {
 		return 0;
 	}
 
-	bn_t  n;
 	g2_t u0, u1, u2, u3;
 	int r = 0;
 
-	bn_null(n);
 	g2_null(u0);
 	g2_null(u1);
 	g2_null(u2);
 	g2_null(u3);
 	RLC_TRY {
-		bn_new(n);
 		g2_new(u0);
 		g2_new(u1);
 		g2_new(u2);
 		g2_new(u3);
 
-       		 fp_prime_get_par(n);
-
 		/* Compute v = a^(n+1)*a^(np)*a^(np^2) and a^(np^3). */
-			g2_copy(u1, a);
-			for (int i = bn_bits(n) - 2; i >= 0; i--) {
-				g2_dbl(u1, u1);
-				if (bn_get_bit(n, i)) {
-					g2_add(u1, u1, a);
-				}
-			}
-		if (bn_sign(n) == RLC_NEG) {
-			g2_neg(u1, u1);
-			}
+		ep2_mul_z(u1, a);
 		g2_add(u0, u1, a);
 		g2_dbl(u3, u1);
 		g2_frb(u2, u1, 2);
@@ -449,8 +462,6 @@ int g2_is_valid_bn(const g2_t a) {
 	RLC_CATCH_ANY {
 		RLC_THROW(ERR_CAUGHT);
 	} RLC_FINALLY {
-		bn_free(p);
-		bn_free(n);
 		g2_free(u0);
 		g2_free(u1);
 		g2_free(u2);
@@ -473,7 +484,7 @@ int gt_is_valid_bn(gt_t a) {
 	bn_null(p);
 	gt_null(u);
 	gt_null(v);
-	gt_null(r);
+	gt_null(y);
 	gt_null(w);
 
 	RLC_TRY {
@@ -481,8 +492,8 @@ int gt_is_valid_bn(gt_t a) {
 		bn_new(p);
 		gt_new(u);
 		gt_new(v);
-		gt_null(r);
-		gt_null(w);
+		gt_new(y);
+		gt_new(w);
 
 
 		pc_get_ord(n);
@@ -510,7 +521,7 @@ int gt_is_valid_bn(gt_t a) {
 		bn_free(n);
 		gt_free(u);
 		gt_free(v);
-		gt_free(r);
+		gt_free(y);
 		gt_free(w);
 
 
@@ -518,7 +529,6 @@ int gt_is_valid_bn(gt_t a) {
 	return r;
 }
 int g1_is_valid_bw13(ep_t a) {
-	bn_t  n;
 	ep_t u0, u1, u2;
 	int r = 0;
 
@@ -526,33 +536,30 @@ int g1_is_valid_bw13(ep_t a) {
 		return 0;
 	}
 
-	bn_null(n);
 	ep_null(u0);
 	ep_null(u1);
 	ep_null(u2);
 	RLC_TRY {
-		bn_new(n);
 		ep_new(u0);
 		ep_new(u1);
 		ep_new(u2);
 
 		/*[a0,a1]=[−(z^7 + z)(z^4 + z^3 − z − 1),a0 · z − 1]*/
 		/*checking a0*a+a1*psi(a)=0, where psi() is a GLV endorphism*/
-		fp_prime_get_par(n);
-		ep_mul_basic(u0, a, n);
-		ep_mul_basic(u1, u0, n);
-		ep_mul_basic(u1, u1, n);
-		ep_mul_basic(u2, u1, n);
+		ep_mul_z(u0, a);
+		ep_mul_z(u1, u0);
+		ep_mul_z(u1, u1);
+		ep_mul_z(u2, u1);
 		ep_add(u0, u0, a);
 		ep_add(u1, u1, u2);
 		ep_sub(u0, u1, u0);
-		ep_mul_basic(u0, u0, n);
-		ep_mul_basic(u1, u0, n);
-                for(int i = 0; i < 5; i++)ep_mul_basic(u1, u1, n);
+		ep_mul_z(u0, u0);
+		ep_mul_z(u1, u0);
+                for(int i = 0; i < 5; i++)ep_mul_z(u1, u1);
 		ep_add(u0, u0, u1);
 		ep_neg(u0, u0);
 
-		ep_mul_basic(u1, u0, n);
+		ep_mul_z(u1, u0);
 		ep_sub(u1, a, u1);
            	ep_psi(u1, u1);
 
@@ -561,7 +568,6 @@ int g1_is_valid_bw13(ep_t a) {
 	RLC_CATCH_ANY {
 		RLC_THROW(ERR_CAUGHT);
 	} RLC_FINALLY {
-		bn_free(n);
 		ep_free(u0);
 		ep_free(u1);
 		ep_free(u2);
@@ -594,7 +600,7 @@ int g2_is_valid_bw13(ep13_t a) {
 		ep13_new(v3);
 
 		/*cheking psi(a)=-z*a, where psi()  is a 24-dimensional endormphism*/
-		ep13_rand_mul_u(u0, a);
+		ep13_mul_z(u0, a);
 		ep13_neg(u0, u0);
                 ep13_psi(u1, a, 1);
 
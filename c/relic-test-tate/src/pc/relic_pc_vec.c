@@ -0,0 +1,541 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2023 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the precomputed Tate Miller loop with the four Miller
+ * values kept in the lanes of a vector register.
+ *
+ * @ingroup pc
+ */
+
+#include "relic_pc.h"
+#include "relic_core.h"
+#include "relic_fp_low.h"
+#include "relic_util.h"
+
+#if ARCH == X64 && WSIZE == 64 && (__GNUC__ >= 8 || __clang_major__ >= 7)
+#define TATE_VEC
+#include <immintrin.h>
+#endif
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Number of 52-bit limbs needed to hold a prime field element.
+ */
+#define VEC_LIMBS		RLC_CEIL(RLC_FP_DIGS * RLC_DIG, 52)
+
+/**
+ * Mask for a 52-bit limb.
+ */
+#define VEC_MASK		0xFFFFFFFFFFFFFULL
+
+/**
+ * Lanes holding the numerators (N1, N2) of the Miller values. The remaining
+ * lanes hold the denominators (D1, D2).
+ */
+#define VEC_NUM			0x5
+
+/**
+ * Maximum number of vector multiplications in a step of the Miller loop.
+ */
+#define VEC_OPS			3
+
+/**
+ * Lanes squared by each vector multiplication of a step of the Miller loop,
+ * indexed by the step opcode. The other lanes are multiplied by a line
+ * function value. A value of -1 ends the step.
+ */
+static const int8_t vec_sch[][VEC_OPS + 1] = {
+	/* TATE_SQPL: N <- N^4 * f, D <- (D^2 * g)^2. */
+	{ 0xF, VEC_NUM, 0xF ^ VEC_NUM, -1 },
+	/* TATE_SADD: N <- N * f, D <- D * g. */
+	{ 0x0, -1 },
+	/* TATE_SSUB: N <- N * f, D <- D * g. */
+	{ 0x0, -1 },
+	/* TATE_SDADD: N <- N^2 * f, D <- (D * g)^2. */
+	{ VEC_NUM, 0xF ^ VEC_NUM, -1 },
+	/* TATE_SDSUB: N <- N^2 * f, D <- (D * g)^2 * h. */
+	{ VEC_NUM, 0xF ^ VEC_NUM, 0x0, -1 },
+	/* TATE_SDBL: N <- N^2 * f, D <- D^2 * g. */
+	{ 0xF, 0x0, -1 },
+	/* TATE_SDSUBL: N <- N^2, D <- D^2 * g. */
+	{ 0xF, 0x0, -1 },
+};
+
+#ifdef TATE_VEC
+
+/**
+ * Converts four prime field elements to the interleaved 52-bit radix.
+ *
+ * @param[out] r			- the interleaved limbs.
+ * @param[in] a				- the prime field elements.
+ */
+static void vec_pack(uint64_t r[][4], const dig_t *a[4]) {
+	int i, k, w, s;
+
+	for (k = 0; k < 4; k++) {
+		for (i = 0; i < VEC_LIMBS; i++) {
+			w = (52 * i) / RLC_DIG;
+			s = (52 * i) % RLC_DIG;
+			r[i][k] = a[k][w] >> s;
+			if (s > RLC_DIG - 52 && w + 1 < RLC_FP_DIGS) {
+				r[i][k] |= a[k][w + 1] << (RLC_DIG - s);
+			}
+			r[i][k] &= VEC_MASK;
+		}
+	}
+}
+
+/**
+ * Converts four prime field elements from the interleaved 52-bit radix.
+ *
+ * @param[out] c			- the prime field elements.
+ * @param[in] r				- the interleaved limbs.
+ */
+static void vec_unpack(dig_t *c[4], const uint64_t r[][4]) {
+	int i, k, w, s;
+
+	for (k = 0; k < 4; k++) {
+		dv_zero(c[k], RLC_FP_DIGS);
+		for (i = 0; i < VEC_LIMBS; i++) {
+			w = (52 * i) / RLC_DIG;
+			s = (52 * i) % RLC_DIG;
+			c[k][w] |= r[i][k] << s;
+			if (s > RLC_DIG - 52 && w + 1 < RLC_FP_DIGS) {
+				c[k][w + 1] |= r[i][k] >> (RLC_DIG - s);
+			}
+		}
+	}
+}
+
+/**
+ * Multiplies four pairs of prime field elements in the interleaved 52-bit
+ * radix using Montgomery reduction modulo 2^(52 * VEC_LIMBS). Computes
+ * c_k = a_k * b_k / 2^(52 * VEC_LIMBS) mod p for each lane k.
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the first operands.
+ * @param[in] b				- the second operands.
+ * @param[in] p				- the broadcast limbs of the prime modulus.
+ * @param[in] u				- the broadcast value -p^(-1) mod 2^52.
+ */
+__attribute__((target("avx512ifma,avx512vl")))
+static void vec_mul(__m256i *c, const __m256i *a, const __m256i *b,
+		const __m256i *p, __m256i u) {
+	__m256i t[VEC_LIMBS + 1], s[VEC_LIMBS], m, z, mask;
+	int i, j;
+
+	z = _mm256_setzero_si256();
+	mask = _mm256_set1_epi64x(VEC_MASK);
+	for (j = 0; j <= VEC_LIMBS; j++) {
+		t[j] = z;
+	}
+	/* Accumulators have 12 spare bits, enough for 4 * VEC_LIMBS additions. */
+	for (i = 0; i < VEC_LIMBS; i++) {
+		for (j = 0; j < VEC_LIMBS; j++) {
+			t[j] = _mm256_madd52lo_epu64(t[j], a[i], b[j]);
+			t[j + 1] = _mm256_madd52hi_epu64(t[j + 1], a[i], b[j]);
+		}
+		m = _mm256_madd52lo_epu64(z, t[0], u);
+		for (j = 0; j < VEC_LIMBS; j++) {
+			t[j] = _mm256_madd52lo_epu64(t[j], m, p[j]);
+			t[j + 1] = _mm256_madd52hi_epu64(t[j + 1], m, p[j]);
+		}
+		m = _mm256_srli_epi64(t[0], 52);
+		for (j = 0; j < VEC_LIMBS; j++) {
+			t[j] = t[j + 1];
+		}
+		t[VEC_LIMBS] = z;
+		t[0] = _mm256_add_epi64(t[0], m);
+	}
+	for (j = 0; j < VEC_LIMBS - 1; j++) {
+		t[j + 1] = _mm256_add_epi64(t[j + 1], _mm256_srli_epi64(t[j], 52));
+		t[j] = _mm256_and_si256(t[j], mask);
+	}
+	/* The result is smaller than 2p, subtract p from lanes that allow it. */
+	m = z;
+	for (j = 0; j < VEC_LIMBS; j++) {
+		s[j] = _mm256_sub_epi64(_mm256_sub_epi64(t[j], p[j]), m);
+		m = _mm256_srli_epi64(s[j], 63);
+		s[j] = _mm256_and_si256(s[j], mask);
+	}
+	m = _mm256_cmpeq_epi64(m, _mm256_set1_epi64x(1));
+	for (j = 0; j < VEC_LIMBS; j++) {
+		c[j] = _mm256_blendv_epi8(s[j], t[j], m);
+	}
+}
+
+/**
+ * Executes one vector multiplication of a step of the Miller loop, squaring
+ * the lanes selected by a mask and multiplying the others by line function
+ * values.
+ *
+ * @param[in,out] acc		- the interleaved Miller values.
+ * @param[in] mask			- the lanes to square.
+ * @param[in] m				- the line function value for each lane.
+ * @param[in] p				- the broadcast limbs of the prime modulus.
+ * @param[in] u				- the broadcast value -p^(-1) mod 2^52.
+ */
+__attribute__((target("avx512ifma,avx512vl")))
+static void vec_op(__m256i *acc, int mask, const dig_t *m[4],
+		const __m256i *p, __m256i u) {
+	uint64_t r[VEC_LIMBS][4] __attribute__((aligned(32)));
+	__m256i b[VEC_LIMBS], sel;
+	int i;
+
+	if (mask == 0xF) {
+		vec_mul(acc, acc, acc, p, u);
+		return;
+	}
+	vec_pack(r, m);
+	sel = _mm256_set_epi64x(-((mask >> 3) & 1), -((mask >> 2) & 1),
+			-((mask >> 1) & 1), -(mask & 1));
+	for (i = 0; i < VEC_LIMBS; i++) {
+		b[i] = _mm256_load_si256((const __m256i *)r[i]);
+		b[i] = _mm256_blendv_epi8(b[i], acc[i], sel);
+	}
+	vec_mul(acc, acc, b, p, u);
+}
+
+/**
+ * Runs the precomputed Miller loop with vector instructions.
+ *
+ * @param[in] tab			- the precomputed Miller table.
+ * @param[in,out] N1		- the numerator of the first Miller value.
+ * @param[in,out] D1		- the denominator of the first Miller value.
+ * @param[in,out] N2		- the numerator of the second Miller value.
+ * @param[in,out] D2		- the denominator of the second Miller value.
+ * @param[in] q				- the auxiliary point.
+ * @param[in] p				- the point to test.
+ * @param[in] p2			- the image of the point by the endomorphism.
+ */
+__attribute__((target("avx512ifma,avx512vl")))
+static void vec_miller(fp_t *tab, fp_t N1, fp_t D1, fp_t N2, fp_t D2,
+		g1_t q, g1_t p, g1_t p2) {
+	const ctx_t *ctx = core_get();
+	uint64_t r[VEC_LIMBS][4] __attribute__((aligned(32)));
+	__m256i acc[VEC_LIMBS], pr[VEC_LIMBS], u;
+	const dig_t *prime = fp_prime_get(), *in[4], *m[VEC_OPS][4];
+	dig_t *out[4];
+	fp_t f1, g1, f2, g2, h1, h2, one, u0, u1, u2, u3;
+	dv_t v0, v1, v2;
+	uint64_t inv;
+	int i, j, k = 0;
+
+	fp_null(f1);
+	fp_null(g1);
+	fp_null(f2);
+	fp_null(g2);
+	fp_null(h1);
+	fp_null(h2);
+	fp_null(one);
+	fp_null(u0);
+	fp_null(u1);
+	fp_null(u2);
+	fp_null(u3);
+	dv_null(v0);
+	dv_null(v1);
+	dv_null(v2);
+
+	RLC_TRY {
+		fp_new(f1);
+		fp_new(g1);
+		fp_new(f2);
+		fp_new(g2);
+		fp_new(h1);
+		fp_new(h2);
+		fp_new(one);
+		fp_new(u0);
+		fp_new(u1);
+		fp_new(u2);
+		fp_new(u3);
+		dv_new(v0);
+		dv_new(v1);
+		dv_new(v2);
+
+		/* Broadcast the modulus and compute -p^(-1) mod 2^52. */
+		for (i = 0; i < 4; i++) {
+			in[i] = prime;
+		}
+		vec_pack(r, in);
+		for (i = 0; i < VEC_LIMBS; i++) {
+			pr[i] = _mm256_load_si256((const __m256i *)r[i]);
+		}
+		inv = 1;
+		for (i = 0; i < 6; i++) {
+			inv *= 2 - prime[0] * inv;
+		}
+		u = _mm256_set1_epi64x((-inv) & VEC_MASK);
+
+		in[0] = N1;
+		in[1] = D1;
+		in[2] = N2;
+		in[3] = D2;
+		vec_pack(r, in);
+		for (i = 0; i < VEC_LIMBS; i++) {
+			acc[i] = _mm256_load_si256((const __m256i *)r[i]);
+		}
+
+		fp_set_dig(one, 1);
+		fp_sub(u1, p->y, q->y);//d3
+		fp_sub(u2, p->x, q->x);//d1
+		fp_sub(u3, p2->x, q->x);//d2
+		for (i = 0; i < ctx->tate_len; i++) {
+			/* Compute the line function values as in tate_miller_pre(). */
+			switch (ctx->tate_op[i]) {
+				case TATE_SQPL:
+					fp_sub(u0, p->y, tab[k+2]);
+					fp_sub(f1, p->x, tab[k+1]);
+					fp_sub(f2, p2->x, tab[k+1]);
+					fp_mul(g1, f1, tab[k]);
+					fp_sub(g1, u0, g1);
+					fp_mul(g2, f2, tab[k]);
+					fp_sub(g2, u0, g2);
+					fp_mul(f1, f1, tab[k+3]);
+					fp_sub(f1, u0, f1);
+					fp_mul(f2, f2, tab[k+3]);
+					fp_sub(f2, u0, f2);
+					m[1][1] = g1;
+					m[1][3] = g2;
+					m[2][0] = f1;
+					m[2][2] = f2;
+					k = k + 4;
+					break;
+				case TATE_SADD:
+					fp_mul(f1, tab[k], u2);
+					fp_sub(f1, u1, f1);
+					fp_mul(f2, tab[k], u3);
+					fp_sub(f2, u1, f2);
+					fp_sub(g1, p->x, tab[k+1]);
+					fp_sub(g2, p2->x, tab[k+1]);
+					m[0][0] = f1;
+					m[0][1] = g1;
+					m[0][2] = f2;
+					m[0][3] = g2;
+					k = k + 2;
+					break;
+				case TATE_SSUB:
+					fp_sub(f1, p->x, tab[k+1]);
+					fp_sub(f2, p2->x, tab[k+1]);
+					fp_mul(g1, tab[k], u2);
+					fp_sub(g1, u1, g1);
+					fp_mul(g2, tab[k], u3);
+					fp_sub(g2, u1, g2);
+					m[0][0] = f1;
+					m[0][1] = g1;
+					m[0][2] = f2;
+					m[0][3] = g2;
+					k = k + 2;
+					break;
+				case TATE_SDADD:
+				case TATE_SDSUB:
+					fp_sub(h1, p->x, tab[k]);
+					fp_sub(h2, p2->x, tab[k]);
+					fp_add(g2, p->x, tab[k+2]);
+					fp_add(f1, p2->x, tab[k+2]);
+					fp_muln_low(v0, h1, g2);
+					fp_muln_low(v1, h2, f1);
+					fp_sub(g2, p->y, tab[k+1]);
+					fp_muln_low(v2, g2, tab[k+3]);
+					fp_subc_low(v0, v0, v2);
+					fp_subc_low(v1, v1, v2);
+					fp_rdc(f1, v0);
+					fp_rdc(f2, v1);
+					m[0][1] = h1;
+					m[0][3] = h2;
+					m[1][0] = f1;
+					m[1][2] = f2;
+					m[2][0] = one;
+					m[2][1] = u2;
+					m[2][2] = one;
+					m[2][3] = u3;
+					k = k + 4;
+					break;
+				case TATE_SDBL:
+					fp_sub(f1, p->x, tab[k+1]);
+					fp_sub(f2, p2->x, tab[k+1]);
+					fp_sub(u0, p->y, tab[k+2]);
+					fp_mul(g1, tab[k], f1);
+					fp_sub(g1, u0, g1);
+					fp_mul(g2, tab[k], f2);
+					fp_sub(g2, u0, g2);
+					m[1][0] = f1;
+					m[1][1] = g1;
+					m[1][2] = f2;
+					m[1][3] = g2;
+					k = k + 3;
+					break;
+				case TATE_SDSUBL:
+					fp_sub(g1, p->x, tab[k]);
+					fp_sub(g2, p2->x, tab[k]);
+					m[1][0] = one;
+					m[1][1] = g1;
+					m[1][2] = one;
+					m[1][3] = g2;
+					break;
+			}
+			/* Lanes that are squared ignore their line function values. */
+			for (j = 0; j < VEC_OPS && vec_sch[ctx->tate_op[i]][j] >= 0; j++) {
+				if (vec_sch[ctx->tate_op[i]][j] != 0xF) {
+					for (int l = 0; l < 4; l++) {
+						if ((vec_sch[ctx->tate_op[i]][j] >> l) & 1) {
+							m[j][l] = one;
+						}
+					}
+				}
+				vec_op(acc, vec_sch[ctx->tate_op[i]][j], m[j], pr, u);
+			}
+		}
+
+		for (i = 0; i < VEC_LIMBS; i++) {
+			_mm256_store_si256((__m256i *)r[i], acc[i]);
+		}
+		out[0] = N1;
+		out[1] = D1;
+		out[2] = N2;
+		out[3] = D2;
+		vec_unpack(out, r);
+		/* Remove the scaling introduced by the 52-bit Montgomery radix. */
+		fp_mul(N1, N1, ctx->tate_cor[0]);
+		fp_mul(N2, N2, ctx->tate_cor[0]);
+		fp_mul(D1, D1, ctx->tate_cor[1]);
+		fp_mul(D2, D2, ctx->tate_cor[1]);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp_free(f1);
+		fp_free(g1);
+		fp_free(f2);
+		fp_free(g2);
+		fp_free(h1);
+		fp_free(h2);
+		fp_free(one);
+		fp_free(u0);
+		fp_free(u1);
+		fp_free(u2);
+		fp_free(u3);
+		dv_free(v0);
+		dv_free(v1);
+		dv_free(v2);
+	}
+}
+
+#endif /* TATE_VEC */
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+int tate_vec_calc(void) {
+	ctx_t *ctx = core_get();
+	int i, j, l, r = 0;
+	bn_t e;
+	fp_t f[2], r52, rm;
+
+#ifdef TATE_VEC
+	r = __builtin_cpu_supports("avx512ifma") &&
+			__builtin_cpu_supports("avx512vl");
+#endif
+	if (ctx->tate_len == 0) {
+		r = 0;
+	}
+	ctx->tate_vec = r;
+	if (r == 0) {
+		return 0;
+	}
+
+	bn_null(e);
+	fp_null(f[0]);
+	fp_null(f[1]);
+	fp_null(r52);
+	fp_null(rm);
+
+	RLC_TRY {
+		bn_new(e);
+		fp_new(f[0]);
+		fp_new(f[1]);
+		fp_new(r52);
+		fp_new(rm);
+
+		/* Compute 2^(-52 * VEC_LIMBS) and the radix of fp_mul(). */
+		bn_set_2b(e, 52 * VEC_LIMBS);
+		bn_mod(e, e, &(ctx->prime));
+		fp_prime_conv(r52, e);
+		fp_inv(r52, r52);
+#if FP_RDC == MONTY
+		bn_set_2b(e, RLC_FP_DIGS * RLC_DIG);
+		bn_mod(e, e, &(ctx->prime));
+		fp_prime_conv(rm, e);
+#else
+		fp_set_dig(rm, 1);
+#endif
+		/* Track the factor accumulated by numerator and denominator lanes. */
+		fp_copy(f[0], rm);
+		fp_copy(f[1], rm);
+		for (i = 0; i < ctx->tate_len; i++) {
+			for (j = 0; j < VEC_OPS && vec_sch[ctx->tate_op[i]][j] >= 0; j++) {
+				for (l = 0; l < 2; l++) {
+					if ((vec_sch[ctx->tate_op[i]][j] >> l) & 1) {
+						fp_sqr(f[l], f[l]);
+					} else {
+						fp_mul(f[l], f[l], rm);
+					}
+					fp_mul(f[l], f[l], r52);
+				}
+			}
+		}
+		for (l = 0; l < 2; l++) {
+			fp_inv(f[l], f[l]);
+			fp_mul(ctx->tate_cor[l], f[l], rm);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(e);
+		fp_free(f[0]);
+		fp_free(f[1]);
+		fp_free(r52);
+		fp_free(rm);
+	}
+	return r;
+}
+
+void tate_miller_vec(fp_t *tab, fp_t N1, fp_t D1, fp_t N2, fp_t D2, g1_t q,
+		g1_t p, g1_t p2) {
+#ifdef TATE_VEC
+	if (core_get()->tate_vec) {
+		vec_miller(tab, N1, D1, N2, D2, q, p, p2);
+		return;
+	}
+#endif
+	tate_miller_pre(tab, N1, D1, N2, D2, q, p, p2);
+}
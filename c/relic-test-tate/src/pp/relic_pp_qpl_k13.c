@@ -43,6 +43,7 @@ void pp_qpl_k13_projc_lazyr(fp13_t f1, fp13_t g1, fp13_t f2, fp13_t g2, ep13_t q
 	fp13_t t0, tt0, t1, t2, t3, t4, t5;
 	dv13_t u0, u1, u2;
 	ep13_t _q;
+	ep13_null(_q);
 	fp13_null(t0);
 	fp13_null(tt0);
 	fp13_null(t1);
@@ -55,12 +56,14 @@ void pp_qpl_k13_projc_lazyr(fp13_t f1, fp13_t g1, fp13_t f2, fp13_t g2, ep13_t q
 	dv13_null(u2);
 
 	RLC_TRY {
+		ep13_new(_q);
 		fp13_new(t0);
 		fp13_new(tt0);
 		fp13_new(t1);
 		fp13_new(t2);
 		fp13_new(t3);
 		fp13_new(t4);
+		fp13_new(t5);
 		dv13_new(u0);
 		dv13_new(u1);
 		dv13_new(u2);
@@ -140,6 +143,7 @@ void pp_qpl_k13_projc_lazyr(fp13_t f1, fp13_t g1, fp13_t f2, fp13_t g2, ep13_t q
 		RLC_THROW(ERR_CAUGHT);
 	}
 	RLC_FINALLY {
+		ep13_free(_q);
 		fp13_free(t0);
 		fp13_free(tt0);
 		fp13_free(t1);
@@ -159,6 +163,7 @@ void pp_dba_k13_projc_lazyr(fp13_t f1, fp13_t g1, fp13_t f2, fp13_t g2,  ep13_t
 	fp13_t t0, tt0, t1, tt1, t2, t3, t4, t5;
 	dv13_t u0, u1, u2;
 	ep13_t _q;
+	ep13_null(_q);
 	fp13_null(t0);
 	fp13_null(tt0);
 	fp13_null(t1);
@@ -172,6 +177,7 @@ void pp_dba_k13_projc_lazyr(fp13_t f1, fp13_t g1, fp13_t f2, fp13_t g2,  ep13_t
 	dv13_null(u2);
 
 	RLC_TRY {
+		ep13_new(_q);
 		fp13_new(t0);
 		fp13_new(tt0);
 		fp13_new(t1);
@@ -261,6 +267,7 @@ void pp_dba_k13_projc_lazyr(fp13_t f1, fp13_t g1, fp13_t f2, fp13_t g2,  ep13_t
 		RLC_THROW(ERR_CAUGHT);
 	}
 	RLC_FINALLY {
+		ep13_free(_q);
 		fp13_free(t0);
 		fp13_free(tt0);
 		fp13_free(tt1);
@@ -282,6 +289,7 @@ void pp_add_k13_projc_lazyr(fp13_t f1, fp13_t g1, fp13_t f2, fp13_t g2, ep13_t r
 	fp13_t t0, tt0, tt1, t1, t2, t3, t4;
 	dv13_t u0, u1;
 	ep13_t _r;
+	ep13_null(_r);
 	
 	fp13_null(t0);
 	fp13_null(tt0);
@@ -295,10 +303,11 @@ void pp_add_k13_projc_lazyr(fp13_t f1, fp13_t g1, fp13_t f2, fp13_t g2, ep13_t r
 
 
 	RLC_TRY {
+		ep13_new(_r);
 		fp13_new(t0);
-		fp13_null(tt0);
+		fp13_new(tt0);
 		fp13_new(t1);
-		fp13_null(tt1);
+		fp13_new(tt1);
 		fp13_new(t2);
 		fp13_new(t3);
 		fp13_new(t4);
@@ -351,6 +360,7 @@ void pp_add_k13_projc_lazyr(fp13_t f1, fp13_t g1, fp13_t f2, fp13_t g2, ep13_t r
 		RLC_THROW(ERR_CAUGHT);
 	}
 	RLC_FINALLY {
+		ep13_free(_r);
 		fp13_free(t0);
 	        fp13_free(tt0);
 		fp13_free(t1);
@@ -358,10 +368,8 @@ void pp_add_k13_projc_lazyr(fp13_t f1, fp13_t g1, fp13_t f2, fp13_t g2, ep13_t r
 		fp13_free(t2);
 		fp13_free(t3);
 		fp13_free(t4);
-		fp13_free(t5);
-		fp13_free(t6);
-		dv2_free(u0);
-		dv2_free(u1);
+		dv13_free(u0);
+		dv13_free(u1);
 	}
 }
 
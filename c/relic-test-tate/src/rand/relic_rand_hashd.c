@@ -127,7 +127,7 @@ static int rand_add(uint8_t *state, uint8_t *hash, size_t size) {
 static void rand_gen(uint8_t *out, size_t out_len) {
 	int m = RLC_CEIL(out_len, RLC_MD_LEN);
 	uint8_t hash[RLC_MD_LEN], data[(RLC_RAND_SIZE - 1)/2];
-	ctx_t *ctx = core_get();
+	thr_t *ctx = core_thr();
 
 	/* data = V */
 	memcpy(data, ctx->rand + 1, (RLC_RAND_SIZE - 1)/2);
@@ -154,7 +154,7 @@ static void rand_gen(uint8_t *out, size_t out_len) {
 void rand_bytes(uint8_t *buf, size_t size) {
 	uint8_t hash[RLC_MD_LEN];
 	int carry, len  = (RLC_RAND_SIZE - 1)/2;
-	ctx_t *ctx = core_get();
+	thr_t *ctx = core_thr();
 
 	if (sizeof(int) > 2 && size > (1 << 16)) {
 		RLC_THROW(ERR_NO_VALID);
@@ -175,7 +175,7 @@ void rand_bytes(uint8_t *buf, size_t size) {
 }
 
 void rand_seed(uint8_t *buf, size_t size) {
-	ctx_t *ctx = core_get();
+	thr_t *ctx = core_thr();
 	size_t len = (RLC_RAND_SIZE - 1) / 2;
 
 	if (size <= 0) {
@@ -60,7 +60,7 @@ void rand_bytes(uint8_t *buf, size_t size) {
 
 void rand_seed(uint8_t *buf, size_t size) {
 	/* Do nothing, mark as seeded. */
-	core_get()->seeded = 1;
+	core_thr()->seeded = 1;
 }
 
 #endif
@@ -52,7 +52,7 @@
 #if RAND == UDEV
 
 void rand_bytes(uint8_t *buf, size_t size) {
-	int c, l, *fd = (int *)&(core_get()->rand);
+	int c, l, *fd = (int *)&(core_thr()->rand);
 
 	l = 0;
 	do {
@@ -67,7 +67,7 @@ void rand_bytes(uint8_t *buf, size_t size) {
 
 void rand_seed(uint8_t *buf, size_t size) {
 	/* Do nothing, only mark as seeded. */
-	core_get()->seeded = 1;
+	core_thr()->seeded = 1;
 }
 
 #endif
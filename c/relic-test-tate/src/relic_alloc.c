@@ -0,0 +1,348 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2024 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the per-thread arena allocator.
+ *
+ * Each thread owns a chunk of RLC_ARENA_SIZE bytes and serves allocations by
+ * bumping a pointer. Every block starts with a header linking it to the
+ * previous block, so releasing the topmost block also reclaims the blocks
+ * below it that were already released. Since library temporaries are released
+ * in the reverse order of allocation, the arena behaves like a second stack.
+ * Blocks that do not fit fall back to the system allocator.
+ *
+ * @ingroup relic
+ */
+
+#include <stdint.h>
+
+#include "relic_core.h"
+#include "relic_alloc.h"
+
+#if ALLOC == ARENA
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Alignment of the blocks served by the arena.
+ */
+#define UNIT		(ALIGN > 16 ? ALIGN : 16)
+
+/**
+ * Flag stored in the size of a block once it was released.
+ */
+#define FREED		((uint32_t)1 << 31)
+
+/**
+ * Increments a counter that may be updated by other threads.
+ *
+ * @param[in,out] R			- the counter.
+ * @return the new value of the counter.
+ */
+#if defined(MULTI)
+#define ref_inc(R)			__sync_add_and_fetch(R, 1)
+#else
+#define ref_inc(R)			(++(*(R)))
+#endif
+
+/**
+ * Decrements a counter that may be updated by other threads.
+ *
+ * @param[in,out] R			- the counter.
+ * @return the new value of the counter.
+ */
+#if defined(MULTI)
+#define ref_dec(R)			__sync_sub_and_fetch(R, 1)
+#else
+#define ref_dec(R)			(--(*(R)))
+#endif
+
+/**
+ * Marks a block as released, possibly from another thread.
+ *
+ * @param[in,out] H			- the block header.
+ */
+#if defined(MULTI)
+#define mark_freed(H)		__sync_fetch_and_or(&(H)->size, FREED)
+#else
+#define mark_freed(H)		((H)->size |= FREED)
+#endif
+
+/**
+ * Arena of a thread.
+ */
+typedef struct {
+	/** The chunk backing the arena. */
+	uint8_t *base;
+	/** The offset of the first free byte. */
+	size_t top;
+	/** The offset plus one of the topmost block, or zero if there is none. */
+	size_t last;
+	/** The number of blocks in use, plus one while a thread owns the arena. */
+	int live;
+} arena_t;
+
+/**
+ * Header preceding each block.
+ */
+typedef struct {
+	/** The arena serving the block, or NULL if it came from the system. */
+	arena_t *arena;
+	/** The offset plus one of the previous block, or zero if there is none. */
+	uint32_t prev;
+	/** The number of bytes requested, with FREED set once released. */
+	volatile uint32_t size;
+} head_t;
+
+/**
+ * Rounds a number of bytes up to a multiple of the alignment.
+ *
+ * @param[in] S				- the number of bytes.
+ */
+#define round_up(S)			(((S) + UNIT - 1) & ~((size_t)UNIT - 1))
+
+/**
+ * Number of bytes reserved for the header, preserving the alignment.
+ */
+#define HEAD		round_up(sizeof(head_t))
+
+/**
+ * Returns the header of a block.
+ *
+ * @param[in] P				- the block.
+ */
+#define head_of(P)			((head_t *)((uint8_t *)(P) - HEAD))
+
+/**
+ * Allocates aligned memory from the system.
+ *
+ * @param[in] size			- the number of bytes.
+ * @return the memory, or NULL if there is no available memory.
+ */
+static void *sys_alloc(size_t size) {
+	void *p = NULL;
+#if OPSYS == WINDOWS
+	p = _aligned_malloc(size, UNIT);
+#else
+	if (posix_memalign(&p, UNIT, size) != 0) {
+		p = NULL;
+	}
+#endif
+	return p;
+}
+
+/**
+ * Releases memory allocated with sys_alloc().
+ *
+ * @param[in] p				- the memory.
+ */
+static void sys_free(void *p) {
+#if OPSYS == WINDOWS
+	_aligned_free(p);
+#else
+	free(p);
+#endif
+}
+
+/**
+ * Returns the arena of the calling thread, creating it if needed.
+ *
+ * @return the arena, or NULL if there is no available memory.
+ */
+static arena_t *arena_get(void) {
+	thr_t *thr = core_thr();
+	arena_t *a = (arena_t *)thr->arena;
+
+	if (a == NULL) {
+		a = (arena_t *)malloc(sizeof(arena_t));
+		if (a == NULL) {
+			return NULL;
+		}
+		a->base = (uint8_t *)sys_alloc(RLC_ARENA_SIZE);
+		if (a->base == NULL) {
+			free(a);
+			return NULL;
+		}
+		a->top = a->last = 0;
+		a->live = 1;
+		thr->arena = a;
+	}
+	return a;
+}
+
+/**
+ * Drops a reference to an arena, freeing it with the last one.
+ *
+ * @param[in] a				- the arena.
+ */
+static void arena_unref(arena_t *a) {
+	if (ref_dec(&(a->live)) == 0) {
+		sys_free(a->base);
+		free(a);
+	}
+}
+
+/**
+ * Reclaims the released blocks at the top of an arena.
+ *
+ * @param[in,out] a			- the arena.
+ */
+static void arena_pop(arena_t *a) {
+	while (a->last != 0) {
+		head_t *h = (head_t *)(a->base + a->last - 1);
+		if (!(h->size & FREED)) {
+			break;
+		}
+		a->top = a->last - 1;
+		a->last = h->prev;
+	}
+}
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+void *arena_malloc(size_t size) {
+	arena_t *a = arena_get();
+	size_t need = HEAD + round_up(size);
+	head_t *h;
+
+	if (a != NULL && size < FREED && need <= RLC_ARENA_SIZE - a->top) {
+		h = (head_t *)(a->base + a->top);
+		h->arena = a;
+		h->prev = (uint32_t)a->last;
+		a->last = a->top + 1;
+		a->top += need;
+		ref_inc(&(a->live));
+	} else {
+		if (size >= FREED || (h = (head_t *)sys_alloc(HEAD + size)) == NULL) {
+			return NULL;
+		}
+		h->arena = NULL;
+	}
+	h->size = (uint32_t)size;
+	return (uint8_t *)h + HEAD;
+}
+
+void *arena_calloc(size_t num, size_t size) {
+	void *p;
+
+	if (size != 0 && num > SIZE_MAX / size) {
+		return NULL;
+	}
+	p = arena_malloc(num * size);
+	if (p != NULL) {
+		memset(p, 0, num * size);
+	}
+	return p;
+}
+
+void *arena_realloc(void *ptr, size_t size) {
+	arena_t *a = (arena_t *)core_thr()->arena;
+	head_t *h;
+	void *p;
+	size_t old, off;
+
+	if (ptr == NULL) {
+		return arena_malloc(size);
+	}
+	h = head_of(ptr);
+	old = h->size & ~FREED;
+	if (size <= old) {
+		return ptr;
+	}
+	/* The topmost block of the calling thread can grow in place. */
+	if (a != NULL && h->arena == a) {
+		off = (uint8_t *)h - a->base;
+		if (a->last == off + 1 && size < FREED &&
+				HEAD + round_up(size) <= RLC_ARENA_SIZE - off) {
+			a->top = off + HEAD + round_up(size);
+			h->size = (uint32_t)size;
+			return ptr;
+		}
+	}
+	p = arena_malloc(size);
+	if (p != NULL) {
+		memcpy(p, ptr, old);
+		arena_free(ptr);
+	}
+	return p;
+}
+
+void arena_free(void *ptr) {
+	head_t *h;
+	arena_t *a;
+
+	if (ptr == NULL) {
+		return;
+	}
+	h = head_of(ptr);
+	a = h->arena;
+	if (a == NULL) {
+		sys_free(h);
+		return;
+	}
+	mark_freed(h);
+	if (a == (arena_t *)core_thr()->arena) {
+		arena_pop(a);
+	}
+	/* Blocks of other threads are reclaimed when their owners pop them. */
+	arena_unref(a);
+}
+
+size_t arena_mark(void) {
+	arena_t *a = (arena_t *)core_thr()->arena;
+	return (a == NULL ? 0 : a->top);
+}
+
+void arena_release(size_t mark) {
+	arena_t *a = (arena_t *)core_thr()->arena;
+
+	if (a == NULL) {
+		return;
+	}
+	while (a->last != 0 && a->last - 1 >= mark) {
+		head_t *h = (head_t *)(a->base + a->last - 1);
+		if (!(h->size & FREED)) {
+			ref_dec(&(a->live));
+		}
+		a->top = a->last - 1;
+		a->last = h->prev;
+	}
+}
+
+void arena_clean(void) {
+	thr_t *thr = core_thr();
+	arena_t *a = (arena_t *)thr->arena;
+
+	if (a != NULL) {
+		thr->arena = NULL;
+		arena_unref(a);
+	}
+}
+
+#endif /* ALLOC == ARENA */
@@ -31,6 +31,7 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <time.h>
 
 #include "relic_core.h"
 #include "relic_conf.h"
@@ -74,6 +75,144 @@ static void empty(int *a) {
 #define CLOCK			NULL
 #endif
 
+/**
+ * Unit of the measured timings.
+ */
+#if TIMER == POSIX || TIMER == ANSI || (OPSYS == DUINO && TIMER == HREAL)
+#define UNIT			"microsec"
+#elif TIMER == CYCLE || TIMER == PERF
+#define UNIT			"cycles"
+#else
+#define UNIT			"nanosec"
+#endif
+
+/**
+ * Work shared by all threads measuring throughput.
+ */
+typedef struct {
+	/** The operation. */
+	void (*f)(void *, int);
+	/** The inputs of the operation. */
+	void *args;
+	/** The number of inputs. */
+	int n;
+	/** The library context shared by the workers. */
+	ctx_t *ctx;
+	/** The first input of the next chunk to be processed. */
+	int next;
+} par_t;
+
+#if MULTI == PTHREAD
+
+/**
+ * Processes chunks of consecutive inputs until the work is exhausted.
+ *
+ * @param[in] ptr			- the work description.
+ */
+static void *par_worker(void *ptr) {
+	par_t *par = (par_t *)ptr;
+	int i, j;
+
+	core_set(par->ctx);
+	while ((i = __sync_fetch_and_add(&par->next, RLC_BENCH_CHUNK)) < par->n) {
+		for (j = i; j < RLC_MIN(i + RLC_BENCH_CHUNK, par->n); j++) {
+			par->f(par->args, j);
+		}
+	}
+	return NULL;
+}
+
+#endif
+
+/**
+ * Compares two timings for sorting.
+ *
+ * @param[in] a				- the first timing.
+ * @param[in] b				- the second timing.
+ * @return -1, 0 or 1 if the first timing is smaller, equal or larger.
+ */
+static int cmp(const void *a, const void *b) {
+	ull_t x = *(const ull_t *)a, y = *(const ull_t *)b;
+	return (x > y) - (x < y);
+}
+
+/**
+ * Measures the time elapsed since bench_before() was called.
+ *
+ * @param[in] ctx			- the thread state.
+ * @return the elapsed time.
+ */
+static long long elapsed(thr_t *ctx) {
+	long long result = 0;
+
+#if OPSYS == DUINO && TIMER == HREAL
+	ctx->after = micros();
+	result = (ctx->after - ctx->before);
+#elif TIMER == HREAL || TIMER == HPROC || TIMER == HTHRD
+	clock_gettime(CLOCK, &(ctx->after));
+	result = ((long)ctx->after.tv_sec - (long)ctx->before.tv_sec) * 1000000000;
+	result += (ctx->after.tv_nsec - ctx->before.tv_nsec);
+#elif TIMER == ANSI
+	ctx->after = clock();
+	result = (ctx->after - ctx->before) * 1000000 / CLOCKS_PER_SEC;
+#elif TIMER == POSIX
+	gettimeofday(&(ctx->after), NULL);
+	result = ((long)ctx->after.tv_sec - (long)ctx->before.tv_sec) * 1000000;
+	result += (ctx->after.tv_usec - ctx->before.tv_usec);
+#elif TIMER == CYCLE || TIMER == PERF
+	ctx->after = arch_cycles();
+	result = (ctx->after - ctx->before);
+#else
+	(void)ctx;
+#endif
+	return result;
+}
+
+/**
+ * Writes a record of the current benchmark to the file chosen in bench_args().
+ * Only the first n values among mean, p50, p90, p99 and maximum are written.
+ *
+ * @param[in] ctx			- the thread state.
+ * @param[in] unit			- the unit of the values.
+ * @param[in] thr			- the number of threads.
+ * @param[in] len			- the number of samples, or zero if not available.
+ * @param[in] v				- the values.
+ * @param[in] n				- the number of values.
+ */
+static void record(thr_t *ctx, const char *unit, int thr, int len,
+		const long long *v, int n) {
+	const char *key[] = { "mean", "p50", "p90", "p99", "max" };
+	int i;
+
+	if (ctx->bench_out == NULL) {
+		return;
+	}
+	if (ctx->bench_fmt == BENCH_CSV) {
+		fprintf(ctx->bench_out, "\"%s\",%s,%d,", ctx->label, unit, thr);
+		if (len > 0) {
+			fprintf(ctx->bench_out, "%d", len);
+		}
+		for (i = 0; i < 5; i++) {
+			fprintf(ctx->bench_out, ",");
+			if (i < n) {
+				fprintf(ctx->bench_out, "%lld", v[i]);
+			}
+		}
+		fprintf(ctx->bench_out, "\n");
+	} else {
+		fprintf(ctx->bench_out, "{\"label\": \"%s\", \"unit\": \"%s\", "
+				"\"threads\": %d", ctx->label, unit, thr);
+		if (len > 0) {
+			fprintf(ctx->bench_out, ", \"samples\": %d", len);
+		}
+		for (i = 0; i < n; i++) {
+			fprintf(ctx->bench_out, ", \"%s\": %lld", key[i], v[i]);
+		}
+		fprintf(ctx->bench_out, "}\n");
+	}
+	fflush(ctx->bench_out);
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -81,7 +220,7 @@ static void empty(int *a) {
 #if defined(OVERH) && defined(TIMER) && BENCH > 1
 
 void bench_overhead(void) {
-	ctx_t *ctx = core_get();
+	thr_t *ctx = core_thr();
 	int a[BENCH + 1];
 	int *tmpa;
 
@@ -129,8 +268,18 @@ void bench_overhead(void) {
 #endif /* OVER && TIMER && BENCH > 1 */
 
 void bench_init(void) {
-	ctx_t *ctx = core_get();
+	thr_t *ctx = core_thr();
 	if (ctx != NULL) {
+		ctx->label[0] = '\0';
+		ctx->dist = (ull_t *)malloc(BENCH * BENCH * sizeof(ull_t));
+		ctx->dist_len = 0;
+		ctx->bench_thr = 1;
+		ctx->bench_fmt = BENCH_TEXT;
+		ctx->bench_out = NULL;
+		ctx->dist_over = 0;
+		if (ctx->dist == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
 #ifdef OVERH
 		ctx->over = 0;
 #endif
@@ -149,62 +298,106 @@ void bench_init(void) {
 			RLC_THROW(ERR_NO_FILE);
 		}
 #endif
+		/* Take the median cost of timing nothing as the sampling overhead. */
+		if (ctx->dist != NULL) {
+			for (int i = 0; i < BENCH; i++) {
+				bench_before();
+				ctx->dist[i] = elapsed(ctx);
+			}
+			qsort(ctx->dist, BENCH, sizeof(ull_t), cmp);
+			ctx->dist_over = ctx->dist[BENCH / 2];
+		}
+	}
+}
+
+void bench_args(int argc, char *argv[]) {
+	thr_t *ctx = core_thr();
+	int i;
+
+	for (i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+			ctx->bench_thr = atoi(argv[++i]);
+			if (ctx->bench_thr <= 0) {
+				ctx->bench_thr = RLC_MAX(CORES, 1);
+			}
+		} else if ((strcmp(argv[i], "--csv") == 0 ||
+				strcmp(argv[i], "--json") == 0) && i + 1 < argc) {
+			if (ctx->bench_out != NULL) {
+				fclose(ctx->bench_out);
+			}
+			ctx->bench_fmt = (argv[i][2] == 'c' ? BENCH_CSV : BENCH_JSON);
+			ctx->bench_out = fopen(argv[++i], "w");
+			if (ctx->bench_out == NULL) {
+				ctx->bench_fmt = BENCH_TEXT;
+				RLC_THROW(ERR_NO_FILE);
+				return;
+			}
+			if (ctx->bench_fmt == BENCH_CSV) {
+				fprintf(ctx->bench_out,
+						"label,unit,threads,samples,mean,p50,p90,p99,max\n");
+			}
+		}
 	}
 }
 
+void bench_label(const char *label) {
+	thr_t *ctx = core_thr();
+
+	strncpy(ctx->label, label, RLC_BENCH_LABEL - 1);
+	ctx->label[RLC_BENCH_LABEL - 1] = '\0';
+	util_print("BENCH: %s%*c = ", ctx->label,
+			(int)(32 - strlen(ctx->label)), ' ');
+}
+
 void bench_reset(void) {
 #ifdef TIMER
-	core_get()->total = 0;
+	core_thr()->total = 0;
 #endif
+	core_thr()->dist_len = 0;
 }
 
 void bench_before(void) {
 #if OPSYS == DUINO && TIMER == HREAL
-	core_get()->before = micros();
+	core_thr()->before = micros();
 #elif TIMER == HREAL || TIMER == HPROC || TIMER == HTHRD
-	clock_gettime(CLOCK, &(core_get()->before));
+	clock_gettime(CLOCK, &(core_thr()->before));
 #elif TIMER == ANSI
-	core_get()->before = clock();
+	core_thr()->before = clock();
 #elif TIMER == POSIX
-	gettimeofday(&(core_get()->before), NULL);
+	gettimeofday(&(core_thr()->before), NULL);
 #elif TIMER == CYCLE || TIMER == PERF
-	core_get()->before = arch_cycles();
+	core_thr()->before = arch_cycles();
 #endif
 }
 
 void bench_after(void) {
-	ctx_t *ctx = core_get();
-	long long result;
-
-#if OPSYS == DUINO && TIMER == HREAL
-	core_get()->after = micros();
-	result = (ctx->after - ctx->before);
-#elif TIMER == HREAL || TIMER == HPROC || TIMER == HTHRD
-	clock_gettime(CLOCK, &(ctx->after));
-	result = ((long)ctx->after.tv_sec - (long)ctx->before.tv_sec) * 1000000000;
-	result += (ctx->after.tv_nsec - ctx->before.tv_nsec);
-#elif TIMER == ANSI
-	ctx->after = clock();
-	result = (ctx->after - ctx->before) * 1000000 / CLOCKS_PER_SEC;
-#elif TIMER == POSIX
-	gettimeofday(&(ctx->after), NULL);
-	result = ((long)ctx->after.tv_sec - (long)ctx->before.tv_sec) * 1000000;
-	result += (ctx->after.tv_usec - ctx->before.tv_usec);
-#elif TIMER == CYCLE || TIMER == PERF
-	ctx->after = arch_cycles();
-  	result = (ctx->after - ctx->before);
-#endif
+	thr_t *ctx = core_thr();
+	long long result = elapsed(ctx);
 
 #ifdef TIMER
 	ctx->total += result;
 #else
 	(void)result;
-	(void)ctx;
 #endif
 }
 
+void bench_sample(void) {
+	thr_t *ctx = core_thr();
+	long long result = elapsed(ctx) - (long long)ctx->dist_over;
+
+	if (result < 0) {
+		result = 0;
+	}
+#ifdef TIMER
+	ctx->total += result;
+#endif
+	if (ctx->dist != NULL && ctx->dist_len < BENCH * BENCH) {
+		ctx->dist[ctx->dist_len++] = result;
+	}
+}
+
 void bench_compute(int benches) {
-	ctx_t *ctx = core_get();
+	thr_t *ctx = core_thr();
 #ifdef TIMER
 	ctx->total = ctx->total / benches;
 #ifdef OVERH
@@ -217,29 +410,179 @@ void bench_compute(int benches) {
 }
 
 void bench_print(void) {
-	ctx_t *ctx = core_get();
+	thr_t *ctx = core_thr();
+	long long v = ctx->total;
 
-#if TIMER == POSIX || TIMER == ANSI || (OPSYS == DUINO && TIMER == HREAL)
-	util_print("%lld microsec", ctx->total);
-#elif TIMER == CYCLE || TIMER == PERF
-	util_print("%lld cycles", ctx->total);
-#else
-	util_print("%lld nanosec", ctx->total);
-#endif
+	util_print("%lld " UNIT, v);
 	if (ctx->total < 0) {
 		util_print(" (overflow or bad overhead estimation)\n");
 	} else {
 		util_print("\n");
 	}
+	record(ctx, UNIT, 1, 0, &v, 1);
+}
+
+void bench_dist(void) {
+	thr_t *ctx = core_thr();
+	long long v[5];
+	int n = ctx->dist_len;
+
+	if (n == 0) {
+		util_print("no samples\n");
+		return;
+	}
+	qsort(ctx->dist, n, sizeof(ull_t), cmp);
+	/* Use the nearest-rank definition of percentiles. */
+	v[0] = 0;
+	for (int i = 0; i < n; i++) {
+		v[0] += ctx->dist[i];
+	}
+	v[0] /= n;
+	v[1] = ctx->dist[(50 * n + 99) / 100 - 1];
+	v[2] = ctx->dist[(90 * n + 99) / 100 - 1];
+	v[3] = ctx->dist[(99 * n + 99) / 100 - 1];
+	v[4] = ctx->dist[n - 1];
+	ctx->total = v[0];
+
+	util_print("%lld " UNIT " (p50 = %lld, p90 = %lld, p99 = %lld, "
+			"max = %lld)\n", v[0], v[1], v[2], v[3], v[4]);
+	record(ctx, UNIT, 1, n, v, 5);
+}
+
+void bench_par(const char *label, void (*f)(void *, int), void *args, int n) {
+	thr_t *ctx = core_thr();
+	char buf[RLC_BENCH_LABEL];
+	long long ops, ns;
+	par_t par;
+	int i, t = ctx->bench_thr;
+#ifdef CLOCK_MONOTONIC
+	struct timespec t0, t1;
+#else
+	clock_t t0, t1;
+#endif
+
+	if (n <= 0) {
+		return;
+	}
+#if MULTI != OPENMP && MULTI != PTHREAD
+	t = 1;
+#endif
+	snprintf(buf, sizeof(buf), "%s (%d)", label, t);
+	bench_label(buf);
+
+	par.f = f;
+	par.args = args;
+	par.n = n;
+	par.ctx = core_get();
+	par.next = 0;
+
+#ifdef CLOCK_MONOTONIC
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+#else
+	t0 = clock();
+#endif
+
+#if MULTI == OPENMP
+	omp_set_num_threads(t);
+	#pragma omp parallel for copyin(core_ctx) schedule(dynamic, RLC_BENCH_CHUNK)
+	for (i = 0; i < n; i++) {
+		par.f(par.args, i);
+	}
+#elif MULTI == PTHREAD
+	pthread_t *thread = RLC_ALLOCA(pthread_t, t);
+
+	if (thread == NULL) {
+		RLC_THROW(ERR_NO_MEMORY);
+		return;
+	}
+	/* The calling thread also processes chunks. */
+	for (i = 1; i < t; i++) {
+		if (pthread_create(&thread[i], NULL, par_worker, &par)) {
+			break;
+		}
+	}
+	t = i;
+	par_worker(&par);
+	for (i = 1; i < t; i++) {
+		pthread_join(thread[i], NULL);
+	}
+	RLC_FREE(thread);
+#else
+	for (i = 0; i < n; i++) {
+		par.f(par.args, i);
+	}
+#endif
+
+#ifdef CLOCK_MONOTONIC
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	ns = ((long long)t1.tv_sec - (long long)t0.tv_sec) * 1000000000;
+	ns += (t1.tv_nsec - t0.tv_nsec);
+#else
+	t1 = clock();
+	ns = (long long)(t1 - t0) * 1000000000 / CLOCKS_PER_SEC;
+#endif
+	ops = (ns > 0 ? (long long)n * 1000000000 / ns : 0);
+
+	util_print("%lld ops/sec\n", ops);
+	record(ctx, "ops/sec", t, n, &ops, 1);
 }
 
 ull_t bench_total(void) {
-	return core_get()->total;
+	return core_thr()->total;
+}
+
+void bench_count_before(void) {
+#ifdef FP_COUNT
+	fp_count_get(core_thr()->cnt_before);
+#endif
+}
+
+void bench_count_after(void) {
+#ifdef FP_COUNT
+	thr_t *ctx = core_thr();
+	int i;
+
+	fp_count_get(ctx->cnt);
+	for (i = 0; i < FP_OPS; i++) {
+		ctx->cnt[i] -= ctx->cnt_before[i];
+	}
+#endif
+}
+
+ull_t bench_count(int op) {
+#ifdef FP_COUNT
+	if (op >= 0 && op < FP_OPS) {
+		return core_thr()->cnt[op];
+	}
+#else
+	(void)op;
+#endif
+	return 0;
+}
+
+void bench_count_print(void) {
+#ifdef FP_COUNT
+	util_print("%llum %llumu %llus %llusu %llua %lluad %llur %llui\n",
+			bench_count(FP_OP_MUL), bench_count(FP_OP_MULN),
+			bench_count(FP_OP_SQR), bench_count(FP_OP_SQRN),
+			bench_count(FP_OP_ADD), bench_count(FP_OP_ADDD),
+			bench_count(FP_OP_RDC), bench_count(FP_OP_INV));
+#else
+	util_print("not available, build with FP_COUNT\n");
+#endif
 }
 
 void bench_clean(void) {
+	thr_t *ctx = core_thr();
+	if (ctx != NULL) {
+		free(ctx->dist);
+		ctx->dist = NULL;
+		if (ctx->bench_out != NULL) {
+			fclose(ctx->bench_out);
+			ctx->bench_out = NULL;
+		}
+	}
 #if TIMER == PERF
-	ctx_t *ctx = core_get();
 	if (ctx != NULL) {
 		close(ctx->perf_fd);
 		munmap(ctx->perf_buf, sysconf(_SC_PAGESIZE)),
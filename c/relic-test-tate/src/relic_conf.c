@@ -64,6 +64,8 @@ void conf_print(void) {
 	util_print("-- RELIC " RLC_VERSION " configuration:\n\n");
 #if ALLOC == DYNAMIC
 	util_print("** Allocation mode: DYNAMIC\n\n");
+#elif ALLOC == ARENA
+	util_print("** Allocation mode: ARENA\n\n");
 #elif ALLOC == AUTO
 	util_print("** Allocation mode: AUTO\n\n");
 #endif
@@ -119,6 +121,11 @@ void conf_print(void) {
 	util_print("   Arithmetic method: " PP_METHD "\n\n");
 #endif
 
+#ifdef WITH_PC
+	util_print("** Pairing-based cryptography module options:\n");
+	util_print("   Membership testing method: " PC_METHD "\n\n");
+#endif
+
 #ifdef WITH_FB
 	util_print("** Binary field module options:\n");
 	util_print("   Polynomial size: %d bits, %d words\n", RLC_FB_BITS, RLC_FB_DIGS);
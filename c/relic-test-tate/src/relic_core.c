@@ -72,17 +72,198 @@
 /** Error message respective to ERR_NO_CURVE. */
 #define MSG_NO_RAND			"faulty pseudo-random number generator"
 
+/** Magic number identifying a parameter snapshot. */
+#define SNAP_MAGIC			0x50414E53
+
+/** Version of the snapshot format, to be increased if ctx_t changes. */
+#define SNAP_VER			1
+
+/**
+ * Header of a parameter snapshot. The snapshot is only valid for the build
+ * that produced it, so the header records enough of the configuration to
+ * reject snapshots from other builds.
+ */
+typedef struct {
+	/** The magic number. */
+	uint32_t magic;
+	/** The version of the snapshot format. */
+	uint32_t ver;
+	/** The word size. */
+	uint32_t wsize;
+	/** The precision of the prime field. */
+	uint32_t prime;
+	/** The size of the library context. */
+	uint64_t size;
+	/** The number of entries in the Miller table of the Tate-based test. */
+	uint64_t tab;
+	/** The version of the library. */
+	char lib[16];
+	/** The checksum of the context and the table. */
+	uint64_t sum;
+} snap_t;
+
+/**
+ * Updates a 64-bit checksum with a buffer, using four independent lanes so
+ * that large contexts are processed at memory speed.
+ *
+ * @param[in,out] h			- the four lanes of the checksum.
+ * @param[in] buf			- the buffer.
+ * @param[in] len			- the number of bytes in the buffer.
+ */
+static void snap_sum(uint64_t h[4], const uint8_t *buf, size_t len) {
+	uint64_t w[4];
+	size_t i;
+	int j;
+
+	for (i = 0; i + sizeof(w) <= len; i += sizeof(w)) {
+		memcpy(w, buf + i, sizeof(w));
+		for (j = 0; j < 4; j++) {
+			h[j] = (h[j] ^ w[j]) * 0x100000001B3ULL;
+		}
+	}
+	for (; i < len; i++) {
+		h[0] = (h[0] ^ buf[i]) * 0x100000001B3ULL;
+	}
+}
+
+/**
+ * Fills the header of a parameter snapshot of the current context.
+ *
+ * @param[out] snap			- the header.
+ * @param[in] ctx			- the library context.
+ */
+static void snap_head(snap_t *snap, const ctx_t *ctx) {
+	memset(snap, 0, sizeof(snap_t));
+	snap->magic = SNAP_MAGIC;
+	snap->ver = SNAP_VER;
+	snap->wsize = WSIZE;
+#ifdef WITH_FP
+	snap->prime = FP_PRIME;
+#endif
+	snap->size = sizeof(ctx_t);
+#ifdef WITH_PC
+	snap->tab = (ctx->tate_tab.tab == NULL ? 0 : ctx->tate_tab.len);
+#else
+	(void)ctx;
+#endif
+	strncpy(snap->lib, RLC_VERSION, sizeof(snap->lib) - 1);
+}
+
+/**
+ * Computes the checksum of a parameter snapshot.
+ *
+ * @param[in] snap			- the header.
+ * @param[in] ctx			- the serialized context.
+ * @param[in] tab			- the serialized Miller table.
+ * @return the checksum.
+ */
+static uint64_t snap_check(const snap_t *snap, const uint8_t *ctx,
+		const uint8_t *tab) {
+	uint64_t h[4] = {
+		0xCBF29CE484222325ULL, 0x84222325CBF29CE4ULL,
+		0xCBF29CE4CBF29CE4ULL, 0x8422232584222325ULL
+	};
+
+	snap_sum(h, ctx, snap->size);
+	snap_sum(h, tab, snap->tab * sizeof(fp_t));
+	return h[0] ^ (h[1] * 31) ^ (h[2] * 961) ^ (h[3] * 29791);
+}
+
+/**
+ * Increments a reference counter shared among threads.
+ *
+ * @param[in,out] R			- the reference counter.
+ * @return the new value of the counter.
+ */
+#if defined(MULTI)
+#define ref_inc(R)			__sync_add_and_fetch(R, 1)
+#else
+#define ref_inc(R)			(++(*(R)))
+#endif
+
+/**
+ * Decrements a reference counter shared among threads.
+ *
+ * @param[in,out] R			- the reference counter.
+ * @return the new value of the counter.
+ */
+#if defined(MULTI)
+#define ref_dec(R)			__sync_sub_and_fetch(R, 1)
+#else
+#define ref_dec(R)			(--(*(R)))
+#endif
+
+/**
+ * Default library context, shared by all threads attached to it.
+ */
+static ctx_t first_ctx;
+
+/**
+ * Flag to indicate if the default library context is in use.
+ */
+static int first_used = 0;
+
+/**
+ * Claims the default library context for the calling thread.
+ *
+ * @return 1 if the context was claimed, 0 if it is already in use.
+ */
+static int first_claim(void) {
+#if defined(MULTI)
+	return __sync_bool_compare_and_swap(&first_used, 0, 1);
+#else
+	if (first_used) {
+		return 0;
+	}
+	first_used = 1;
+	return 1;
+#endif
+}
+
+/**
+ * Initializes the state of the calling thread, unless it was initialized
+ * before and not finalized yet.
+ */
+static void thr_init(void) {
+	thr_t *thr = core_thr();
+
+	if (thr->refs++ == 0) {
+		rand_init();
+#if BENCH > 0
+		bench_init();
+#endif
+	}
+}
+
+/**
+ * Finalizes the state of the calling thread once every context initialized
+ * by the thread was finalized.
+ */
+static void thr_clean(void) {
+	thr_t *thr = core_thr();
+
+	if (thr->refs > 0 && --thr->refs == 0) {
+#if BENCH > 0
+		bench_clean();
+#endif
+		rand_clean();
+#if ALLOC == ARENA
+		arena_clean();
+#endif
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
 
 /**
- * Default library context.
+ * State of the current thread.
  */
 #if MULTI
-rlc_thread ctx_t first_ctx;
+rlc_thread thr_t first_thr;
 #else
-static ctx_t first_ctx;
+static thr_t first_thr;
 #endif
 
 #if defined(MULTI)
@@ -100,9 +281,26 @@ static ctx_t *core_ctx = NULL;
 #endif
 
 int core_init(void) {
-	if (core_ctx == NULL) {
-		core_ctx = &(first_ctx);
+	thr_t *thr = core_thr();
+	ctx_t *ctx = core_ctx;
+
+	if (ctx == NULL) {
+		/* The default context may already be shared by other threads. */
+		if (first_claim()) {
+			ctx = &(first_ctx);
+			ctx->alloc = 0;
+		} else {
+			ctx = (ctx_t *)calloc(1, sizeof(ctx_t));
+			if (ctx == NULL) {
+				return RLC_ERR;
+			}
+			ctx->alloc = 1;
+		}
+	} else if (ctx != &(first_ctx)) {
+		ctx->alloc = 0;
 	}
+	ctx->refs = 1;
+	core_ctx = ctx;
 
 #ifdef CHECK
 	core_ctx->reason[ERR_NO_MEMORY] = MSG_NO_MEMORY;
@@ -115,18 +313,14 @@ int core_init(void) {
 	core_ctx->reason[ERR_NO_CURVE] = MSG_NO_CURVE;
 	core_ctx->reason[ERR_NO_CONFIG] = MSG_NO_CONFIG;
 	core_ctx->reason[ERR_NO_RAND] = MSG_NO_RAND;
-	core_ctx->last = NULL;
+	thr->last = NULL;
 #endif /* CHECK */
 
-	core_ctx->code = RLC_OK;
+	thr->code = RLC_OK;
 
 	RLC_TRY {
 		arch_init();
-		rand_init();
-
-#if BENCH > 0
-		bench_init();
-#endif
+		thr_init();
 
 #ifdef WITH_FP
 		fp_prime_init();
@@ -156,42 +350,74 @@ int core_init(void) {
 	return RLC_OK;
 }
 
+int core_attach(ctx_t *ctx) {
+	thr_t *thr = core_thr();
+
+	if (ctx == NULL) {
+		return RLC_ERR;
+	}
+	ref_inc(&(ctx->refs));
+	core_ctx = ctx;
+
+#ifdef CHECK
+	thr->last = NULL;
+#endif
+	thr->code = RLC_OK;
+
+	RLC_TRY {
+		thr_init();
+	} RLC_CATCH_ANY {
+		return RLC_ERR;
+	}
+
+	return RLC_OK;
+}
+
 int core_clean(void) {
+	ctx_t *ctx = core_ctx;
+	int result = core_thr()->code;
+
+	if (ctx == NULL) {
+		return RLC_OK;
+	}
+
+	/* Only the last thread using the context finalizes it. */
+	if (ref_dec(&(ctx->refs)) <= 0) {
 #ifdef WITH_FP
-	fp_prime_clean();
+		fp_prime_clean();
 #endif
 #ifdef WITH_FB
-	fb_poly_clean();
+		fb_poly_clean();
 #endif
 #ifdef WITH_EP
-	ep_curve_clean();
+		ep_curve_clean();
 #endif
 #ifdef WITH_EB
-	eb_curve_clean();
+		eb_curve_clean();
 #endif
 #ifdef WITH_ED
-	ed_curve_clean();
+		ed_curve_clean();
 #endif
 #ifdef WITH_PP
-	pp_map_clean();
+		pp_map_clean();
 #endif
 #ifdef WITH_PC
-	pc_core_clean();
-#endif
-
-#if BENCH > 0
-		bench_clean();
+		pc_core_clean();
 #endif
+		arch_clean();
 
-	arch_clean();
-	rand_clean();
-
-	if (core_ctx != NULL) {
-		int result = core_ctx->code;
 		core_ctx = NULL;
-		return result;
+		if (ctx == &(first_ctx)) {
+			first_used = 0;
+		} else if (ctx->alloc) {
+			free(ctx);
+		}
 	}
-	return RLC_OK;
+
+	/* The thread state goes last, the cleanup above may still allocate. */
+	thr_clean();
+	core_ctx = NULL;
+	return result;
 }
 
 ctx_t *core_get(void) {
@@ -207,6 +433,145 @@ void core_set(ctx_t *ctx) {
 	core_ctx = ctx;
 }
 
+thr_t *core_thr(void) {
+	return &(first_thr);
+}
+
+size_t core_size_bin(void) {
+#if ALLOC == AUTO
+	snap_t snap;
+
+	if (core_ctx == NULL) {
+		return 0;
+	}
+	snap_head(&snap, core_ctx);
+	return sizeof(snap_t) + snap.size + snap.tab * sizeof(fp_t);
+#else
+	return 0;
+#endif
+}
+
+void core_write_bin(uint8_t *bin, size_t len) {
+#if ALLOC == AUTO
+	ctx_t *ctx = core_ctx;
+	snap_t snap;
+
+	if (ctx == NULL) {
+		RLC_THROW(ERR_NO_CONFIG);
+		return;
+	}
+	if (len < core_size_bin()) {
+		RLC_THROW(ERR_NO_BUFFER);
+		return;
+	}
+
+	snap_head(&snap, ctx);
+	memcpy(bin + sizeof(snap_t), ctx, snap.size);
+#ifdef WITH_PC
+	if (snap.tab > 0) {
+		memcpy(bin + sizeof(snap_t) + snap.size, ctx->tate_tab.tab,
+				snap.tab * sizeof(fp_t));
+	}
+#endif
+	snap.sum = snap_check(&snap, bin + sizeof(snap_t),
+			bin + sizeof(snap_t) + snap.size);
+	memcpy(bin, &snap, sizeof(snap_t));
+#else
+	/* Digit vectors are not stored inside the context. */
+	(void)bin;
+	(void)len;
+	RLC_THROW(ERR_NO_CONFIG);
+#endif
+}
+
+int core_read_bin(const uint8_t *bin, size_t len) {
+#if ALLOC == AUTO
+	ctx_t *ctx = core_ctx;
+#ifdef CHECK
+	char *reason[ERR_MAX];
+#endif
+	snap_t snap, head;
+	int i, refs, alloc;
+
+	if (ctx == NULL || len < sizeof(snap_t)) {
+		return RLC_ERR;
+	}
+	memcpy(&snap, bin, sizeof(snap_t));
+	snap_head(&head, ctx);
+	if (snap.magic != head.magic || snap.ver != head.ver ||
+			snap.wsize != head.wsize || snap.prime != head.prime ||
+			snap.size != head.size || memcmp(snap.lib, head.lib,
+			sizeof(snap.lib)) != 0 || snap.tab > 4 * (RLC_FP_BITS + 1) ||
+			len < sizeof(snap_t) + snap.size + snap.tab * sizeof(fp_t)) {
+		return RLC_ERR;
+	}
+	if (snap.sum != snap_check(&snap, bin + sizeof(snap_t),
+			bin + sizeof(snap_t) + snap.size)) {
+		return RLC_ERR;
+	}
+
+	/* Keep what only makes sense in this process. */
+#ifdef CHECK
+	memcpy(reason, ctx->reason, sizeof(reason));
+#endif
+	refs = ctx->refs;
+	alloc = ctx->alloc;
+#ifdef WITH_PC
+	tate_tab_free(&(ctx->tate_tab));
+#endif
+
+	memcpy(ctx, bin + sizeof(snap_t), snap.size);
+
+#ifdef CHECK
+	memcpy(ctx->reason, reason, sizeof(reason));
+#endif
+	ctx->refs = refs;
+	ctx->alloc = alloc;
+	arch_init();
+#if defined(WITH_EB) && defined(EB_PRECO)
+	for (i = 0; i < RLC_EB_TABLE; i++) {
+		ctx->eb_ptr[i] = &(ctx->eb_pre[i]);
+	}
+#endif
+#if defined(WITH_EP) && defined(EP_PRECO)
+	for (i = 0; i < RLC_EP_TABLE; i++) {
+		ctx->ep_ptr[i] = &(ctx->ep_pre[i]);
+	}
+#endif
+#if defined(WITH_EPX) && defined(EP_PRECO)
+	for (i = 0; i < RLC_EP_TABLE; i++) {
+		ctx->ep2_ptr[i] = &(ctx->ep2_pre[i]);
+		ctx->ep3_ptr[i] = &(ctx->ep3_pre[i]);
+		ctx->ep4_ptr[i] = &(ctx->ep4_pre[i]);
+	}
+#endif
+#if defined(WITH_ED) && defined(ED_PRECO)
+	for (i = 0; i < RLC_ED_TABLE; i++) {
+		ctx->ed_ptr[i] = &(ctx->ed_pre[i]);
+	}
+#endif
+#ifdef WITH_PC
+	ctx->tate_tab.tab = NULL;
+	ctx->tate_tab.len = 0;
+	if (snap.tab > 0) {
+		ctx->tate_tab.tab = (fp_t *)malloc(snap.tab * sizeof(fp_t));
+		if (ctx->tate_tab.tab == NULL) {
+			return RLC_ERR;
+		}
+		memcpy(ctx->tate_tab.tab, bin + sizeof(snap_t) + snap.size,
+				snap.tab * sizeof(fp_t));
+		ctx->tate_tab.len = snap.tab;
+	}
+#endif
+	(void)i;
+	return RLC_OK;
+#else
+	(void)bin;
+	(void)len;
+	return RLC_ERR;
+#endif
+}
+
 #if defined(MULTI)
 void core_set_thread_initializer(void(*init)(void *init_ptr), void* init_ptr) {
     core_thread_initializer = init;
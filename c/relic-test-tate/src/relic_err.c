@@ -90,17 +90,17 @@ void err_full_msg(const char *function, const char *file, int line,
 #endif /* VERBS */
 
 void err_get_msg(err_t *e, char **msg) {
-	ctx_t *ctx = core_get();
-	*e = *(ctx->last->error);
-	*msg = ctx->reason[*e];
-	ctx->last = NULL;
+	thr_t *thr = core_thr();
+	*e = *(thr->last->error);
+	*msg = core_get()->reason[*e];
+	thr->last = NULL;
 }
 
 #endif /* CHECK */
 
 int err_get_code(void) {
-	ctx_t *ctx = core_get();
-	int r = ctx->code;
-	ctx->code = RLC_OK;
+	thr_t *thr = core_thr();
+	int r = thr->code;
+	thr->code = RLC_OK;
 	return r;
 }
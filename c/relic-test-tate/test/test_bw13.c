@@ -9,13 +9,16 @@ int test1(void){
 	int code = RLC_ERR;
 	g1_t a,b;
 	uint8_t msg[5];
-	fp_t tab[FP_PRIME];
+	tate_tab_t tab;
 	g1_null(a);
+	g1_null(b);
+	tate_tab_null(tab);
 
 	RLC_TRY {
 		g1_new(a);
+		g1_new(b);
 		g1_tate_gen(b);
-		miller_tab(tab, b);
+		tate_tab_make(tab, b);
 		TEST_CASE("validity test is correct") {
 			g1_set_infty(a);
 			TEST_ASSERT(!g1_is_valid_bw13(a), end);
@@ -34,9 +37,9 @@ int test1(void){
 
 		TEST_CASE("validity test is correct-tate_pre") {
 			g1_set_infty(a);
-			TEST_ASSERT(!g1_is_valid_tate_pre(a,b, tab), end);
+			TEST_ASSERT(!g1_is_valid_tate_pre(a,b, tab->tab), end);
 			g1_rand(a);
-			TEST_ASSERT(g1_is_valid_tate_pre(a, b, tab), end);
+			TEST_ASSERT(g1_is_valid_tate_pre(a, b, tab->tab), end);
 		}
 		TEST_END;
 	TEST_CASE("point hashing is correct") {
@@ -53,14 +56,19 @@ int test1(void){
 	code = RLC_OK;
   end:
 	g1_free(a);
+	g1_free(b);
+	tate_tab_free(tab);
 	return code;
 
 }
 
 int test2(void){
 	int code = RLC_ERR;
-        ep13_t q1, q2, q3;
+        ep13_t q1, q2, q3, t[2];
 	uint8_t msg[5];
+	int res[2];
+	ep13_null(t[0]);
+	ep13_null(t[1]);
 	ep13_null(q1);
 	ep13_null(q2);
 	ep13_null(q3);
@@ -71,6 +79,8 @@ int test2(void){
 		ep13_new(q1);
 		ep13_new(q2);
 		ep13_new(q3);
+		ep13_new(t[0]);
+		ep13_new(t[1]);
 		bn_new(n);
 		bn_new(k);
 		pc_get_ord(n);
@@ -82,6 +92,15 @@ int test2(void){
 			TEST_ASSERT(g2_is_valid_bw13(q2), end);
 		}
 		TEST_END;
+		TEST_CASE("lot validity test is correct") {
+			ep13_set_infty(t[0]);
+			ep13_rand(t[1]);
+			TEST_ASSERT(!g2_is_valid_bw13_lot(res, t, 2, 0), end);
+			TEST_ASSERT(!res[0] && res[1], end);
+			ep13_rand(t[0]);
+			TEST_ASSERT(g2_is_valid_bw13_lot(res, t, 2, 0), end);
+		}
+		TEST_END;
 		TEST_CASE("point hashing is correct") {
 			rand_bytes(msg, sizeof(msg));
 			ep13_map(q1, msg, sizeof(msg));
@@ -101,6 +120,14 @@ int test2(void){
 			
 		}
 		TEST_END;
+		TEST_CASE("multiplication by curve parameter is correct") {
+			ep13_rand(q3);
+			fp_prime_get_par(k);
+			ep13_mul_basic(q1, q3, k);
+			ep13_mul_z(q2, q3);
+			TEST_ASSERT(ep13_cmp(q1, q2) == RLC_EQ, end);
+		}
+		TEST_END;
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -111,6 +138,8 @@ int test2(void){
 	ep13_free(q1);
 	ep13_free(q2);
 	ep13_free(q3);
+	ep13_free(t[0]);
+	ep13_free(t[1]);
 	bn_free(n);
 	bn_free(k);
 	return code;	
@@ -121,7 +150,8 @@ int test3(void){
 	int code = RLC_ERR;
 	ep_t p[2];
 	ep13_t q[2];
-        fp13_t e1, e2, e3;
+        fp13_t e1, e2, e3, t[2];
+	int res[2];
 	bn_t k, n;
 	ep_null(p[0]);
 	ep_null(p[1]);
@@ -140,6 +170,9 @@ int test3(void){
 		ep13_new(q[1]);
 		fp13_new(e1);
 		fp13_new(e2);
+		fp13_new(e3);
+		fp13_new(t[0]);
+		fp13_new(t[1]);
 		bn_new(n);
 		bn_new(k);
 
@@ -154,6 +187,18 @@ int test3(void){
 		}
 		TEST_END;
 
+		TEST_CASE("lot validity test is correct") {
+			fp13_set_dig(t[0], 1);
+			fp13_rand(e1);
+			fp13_rand(e2);
+			pp_exp_bwk13(t[1], e1, e2);
+			TEST_ASSERT(!gt_is_valid_bw13_lot(res, t, 2, 0), end);
+			TEST_ASSERT(!res[0] && res[1], end);
+			fp13_copy(t[0], t[1]);
+			TEST_ASSERT(gt_is_valid_bw13_lot(res, t, 2, 0), end);
+		}
+		TEST_END;
+
 
 		TEST_CASE("exponentiation is correct") {
 			/* given e3 in G_T,  and k in Z_r,we first compute
@@ -215,12 +260,15 @@ int test3(void){
 	}
 	code = RLC_OK;
   end:
-	ep_free(p1);
-	ep_free(p2);
-	ep13_free(q1);
-	ep13_free(q2);
-	fp13_free(f1);
-	fp13_free(f2);
+	ep_free(p[0]);
+	ep_free(p[1]);
+	ep13_free(q[0]);
+	ep13_free(q[1]);
+	fp13_free(e1);
+	fp13_free(e2);
+	fp13_free(e3);
+	fp13_free(t[0]);
+	fp13_free(t[1]);
 	bn_free(n);
 	bn_free(k);
 	return code;
@@ -62,6 +62,34 @@ void *tester(void *ptr) {
 	return NULL;
 }
 
+void *worker(void *ptr) {
+	ctx_t *ctx = (ctx_t *)ptr;
+	int code = RLC_ERR;
+	if (core_attach(ctx) == RLC_OK && core_get() == ctx) {
+		RLC_THROW(ERR_NO_VALID);
+		if (err_get_code() == RLC_ERR) {
+			code = RLC_OK;
+		}
+	}
+	core_clean();
+	return (code == RLC_OK ? ptr : NULL);
+}
+
+#if ALLOC == ARENA
+void *holder(void *ptr) {
+	uint8_t *block = NULL;
+	if (core_attach((ctx_t *)ptr) == RLC_OK) {
+		block = (uint8_t *)arena_malloc(64);
+		if (block != NULL) {
+			memset(block, 0xFF, 64);
+		}
+	}
+	/* The block outlives the thread and its arena. */
+	core_clean();
+	return block;
+}
+#endif
+
 #endif
 #endif
 
@@ -88,18 +116,83 @@ int main(void) {
 		core_set(&new_ctx);
 		/* Reinitialize library with new context. */
 		core_init();
-		/* Run function to manipulate the library context. */
+		TEST_ASSERT(core_get() == &new_ctx, end);
+		/* Run function to manipulate the thread state. */
 		RLC_THROW(ERR_NO_MEMORY);
 		core_set(old_ctx);
-		TEST_ASSERT(err_get_code() == RLC_OK, end);
-		core_set(&new_ctx);
+		/* The error state belongs to the thread, not to the context. */
 		TEST_ASSERT(err_get_code() == RLC_ERR, end);
+		TEST_ASSERT(err_get_code() == RLC_OK, end);
 		/* Now we need to finalize the new context. */
+		core_set(&new_ctx);
 		core_clean();
 		/* And restore the original context. */
 		core_set(old_ctx);
+		TEST_ASSERT(core_get() == old_ctx, end);
+	} TEST_END;
+
+	TEST_ONCE("attaching to the library context is correct") {
+		ctx_t *ctx = core_get();
+#ifdef WITH_FP
+		TEST_ASSERT(fp_param_set_any() == RLC_OK, end);
+#endif
+		TEST_ASSERT(core_attach(ctx) == RLC_OK, end);
+		TEST_ASSERT(core_get() == ctx, end);
+		TEST_ASSERT(ctx->refs == 2, end);
+		/* Releasing the context does not finalize it for the other user. */
+		core_clean();
+		core_set(ctx);
+		TEST_ASSERT(ctx->refs == 1, end);
+#ifdef WITH_FP
+		TEST_ASSERT(fp_prime_get_mod8() != 0, end);
+#endif
 	} TEST_END;
 
+#if ALLOC == ARENA
+	TEST_ONCE("arena allocations are reclaimed in stack order") {
+		size_t mark = arena_mark();
+		uint8_t *a = (uint8_t *)arena_malloc(10);
+		uint8_t *b = (uint8_t *)arena_malloc(100);
+		uint8_t *c;
+		TEST_ASSERT(a != NULL && b != NULL && b > a, end);
+		TEST_ASSERT((uintptr_t)a % 16 == 0 && (uintptr_t)b % 16 == 0, end);
+		/* Releasing a block below the top reclaims nothing yet. */
+		arena_free(a);
+		c = (uint8_t *)arena_malloc(10);
+		TEST_ASSERT(c > b, end);
+		arena_free(c);
+		arena_free(b);
+		TEST_ASSERT(arena_mark() == mark, end);
+		c = (uint8_t *)arena_malloc(10);
+		TEST_ASSERT(c == a, end);
+		/* The topmost block grows in place. */
+		c = (uint8_t *)arena_realloc(c, 1000);
+		TEST_ASSERT(c == a, end);
+		arena_free(c);
+		TEST_ASSERT(arena_mark() == mark, end);
+		/* Blocks larger than the arena come from the system. */
+		a = (uint8_t *)arena_malloc(RLC_ARENA_SIZE);
+		TEST_ASSERT(a != NULL, end);
+		a[RLC_ARENA_SIZE - 1] = 1;
+		arena_free(a);
+		TEST_ASSERT(arena_mark() == mark, end);
+	} TEST_END;
+
+	TEST_ONCE("arena release reclaims everything since the mark") {
+		size_t mark = arena_mark();
+		bn_t k;
+		fp_t t;
+		bn_null(k);
+		fp_null(t);
+		bn_new(k);
+		fp_new(t);
+		TEST_ASSERT(arena_mark() > mark, end);
+		/* No frees are needed for objects allocated after the mark. */
+		arena_release(mark);
+		TEST_ASSERT(arena_mark() == mark, end);
+	} TEST_END;
+#endif
+
 	code = RLC_OK;
 
 #if defined(MULTI)
@@ -162,6 +255,38 @@ int main(void) {
 		}
 		TEST_ASSERT(code == RLC_OK, end);
 	} TEST_END;
+
+	TEST_ONCE("library context can be shared among threads") {
+		pthread_t thread[CORES];
+		void *result[CORES];
+		ctx_t *ctx = core_get();
+		for (int i = 0; i < CORES; i++) {
+			if (pthread_create(&(thread[i]), NULL, worker, ctx)) {
+				code = RLC_ERR;
+			}
+		}
+		for (int i = 0; i < CORES; i++) {
+			if (pthread_join(thread[i], &(result[i])) || result[i] != ctx) {
+				code = RLC_ERR;
+			}
+		}
+		TEST_ASSERT(code == RLC_OK, end);
+		/* Errors in the workers are not seen by this thread. */
+		TEST_ASSERT(err_get_code() == RLC_OK, end);
+		TEST_ASSERT(core_get() == ctx && ctx->refs == 1, end);
+	} TEST_END;
+
+#if ALLOC == ARENA
+	TEST_ONCE("arena blocks can be released by other threads") {
+		pthread_t thread;
+		void *block = NULL;
+		TEST_ASSERT(pthread_create(&thread, NULL, holder, core_get()) == 0,
+				end);
+		TEST_ASSERT(pthread_join(thread, &block) == 0, end);
+		TEST_ASSERT(block != NULL && ((uint8_t *)block)[63] == 0xFF, end);
+		arena_free(block);
+	} TEST_END;
+#endif
 #endif
 #endif
 
@@ -772,6 +772,19 @@ static int multiplication(void) {
 			TEST_ASSERT(ep_cmp(q, r) == RLC_EQ, end);
 		}
 		TEST_END;
+
+		if (fp_prime_get_par_sps(NULL) != NULL) {
+			TEST_CASE("point multiplication by curve parameter is correct") {
+				fp_prime_get_par(k);
+				ep_mul_basic(q, p, k);
+				ep_mul_z(r, p);
+				TEST_ASSERT(ep_cmp(q, r) == RLC_EQ, end);
+				ep_set_infty(q);
+				ep_mul_z(r, q);
+				TEST_ASSERT(ep_is_infty(r), end);
+			}
+			TEST_END;
+		}
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -1338,17 +1351,24 @@ static int hashing(void) {
 	int code = RLC_ERR;
 	ep_t a;
 	ep_t b;
+	ep_t c[4];
 	bn_t n;
 	uint8_t msg[5];
 
 	ep_null(a);
 	ep_null(b);
 	bn_null(n);
+	for (int i = 0; i < 4; i++) {
+		ep_null(c[i]);
+	}
 
 	RLC_TRY {
 		ep_new(a);
 		ep_new(b);
 		bn_new(n);
+		for (int i = 0; i < 4; i++) {
+			ep_new(c[i]);
+		}
 
 		ep_curve_get_ord(n);
 
@@ -1362,6 +1382,37 @@ static int hashing(void) {
 			TEST_ASSERT(ep_is_infty(a) == 1, end);
 		}
 		TEST_END;
+
+		TEST_CASE("cofactor clearing is correct") {
+			do {
+				fp_rand(b->x);
+				fp_set_dig(b->z, 1);
+				b->coord = BASIC;
+				ep_rhs(b->y, b);
+			} while (!fp_srt(b->y, b->y));
+			ep_mul_cof(a, b);
+			ep_mul_basic(b, a, n);
+			TEST_ASSERT(ep_is_infty(b) == 1, end);
+		}
+		TEST_END;
+
+		TEST_CASE("simultaneous point hashing is correct") {
+			uint8_t m[4][32];
+			const uint8_t *ms[4];
+			size_t l[4];
+			for (int i = 0; i < 4; i++) {
+				l[i] = 8 * i;
+				rand_bytes(m[i], sizeof(m[i]));
+				ms[i] = m[i];
+			}
+			ep_map_sim(c, ms, l, 4, (const uint8_t *)"RELIC", 5);
+			for (int i = 0; i < 4; i++) {
+				ep_map_dst(a, m[i], l[i], (const uint8_t *)"RELIC", 5);
+				TEST_ASSERT(ep_cmp(a, c[i]) == RLC_EQ, end);
+				TEST_ASSERT(c[i]->coord == BASIC, end);
+			}
+		}
+		TEST_END;
 	}
 	RLC_CATCH_ANY {
 		RLC_ERROR(end);
@@ -1371,6 +1422,9 @@ static int hashing(void) {
 	ep_free(a);
 	ep_free(b);
 	bn_free(n);
+	for (int i = 0; i < 4; i++) {
+		ep_free(c[i]);
+	}
 	return code;
 }
 
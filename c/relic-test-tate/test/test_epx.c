@@ -578,6 +578,19 @@ static int multiplication2(void) {
 			TEST_ASSERT(ep2_cmp(q, r) == RLC_EQ, end);
 		}
 		TEST_END;
+
+		if (fp_prime_get_par_sps(NULL) != NULL) {
+			TEST_CASE("point multiplication by curve parameter is correct") {
+				fp_prime_get_par(k);
+				ep2_mul_basic(q, p, k);
+				ep2_mul_z(r, p);
+				TEST_ASSERT(ep2_cmp(q, r) == RLC_EQ, end);
+				ep2_set_infty(q);
+				ep2_mul_z(r, q);
+				TEST_ASSERT(ep2_is_infty(r), end);
+			}
+			TEST_END;
+		}
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
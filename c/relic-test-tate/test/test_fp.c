@@ -1035,6 +1035,18 @@ static int exponentiation(void) {
 		}
 		TEST_END;
 #endif
+
+		TEST_CASE("exponentiation by the curve parameter is correct") {
+			fp_rand(a);
+			fp_prime_get_par(d);
+			bn_abs(d, d);
+			fp_exp(c, a, d);
+			fp_exp_z(b, a);
+			TEST_ASSERT(fp_cmp(b, c) == RLC_EQ, end);
+			fp_exp_z(a, a);
+			TEST_ASSERT(fp_cmp(a, c) == RLC_EQ, end);
+		}
+		TEST_END;
 	}
 	RLC_CATCH_ANY {
 		RLC_ERROR(end);
@@ -222,6 +222,53 @@ static int sha256(void) {
 	}
 	TEST_END;
 
+	TEST_ONCE("simultaneous sha256 hash function is correct") {
+		uint8_t msgs[11][200], dig[11 * 32];
+		const uint8_t *in[11];
+		size_t len[11];
+		for (i = 0; i < 11; i++) {
+			len[i] = (i * 29) % 200;
+			rand_bytes(msgs[i], len[i]);
+			in[i] = msgs[i];
+		}
+		md_map_sh256_sim(dig, in, len, 11);
+		for (i = 0; i < 11; i++) {
+			md_map_sh256(digest, in[i], len[i]);
+			TEST_ASSERT(memcmp(digest, dig + 32 * i, 32) == 0, end);
+		}
+		for (i = 0; i < TEST_MAX; i++) {
+			memset(message, 0, MSG_SIZE);
+			for (j = 0; j < count[i]; j++) {
+				strcat((char *)message, tests[i]);
+			}
+			in[0] = message;
+			len[0] = strlen((char *)message);
+			md_map_sh256_sim(dig, in, len, 1);
+			TEST_ASSERT(memcmp(dig, result256[i], 32) == 0, end);
+		}
+	}
+	TEST_END;
+
+	TEST_ONCE("simultaneous sha256 xmd function is correct") {
+		uint8_t msgs[11][200], buf[11 * 75], out[75], dst[37];
+		const uint8_t *in[11];
+		size_t len[11];
+		rand_bytes(dst, sizeof(dst));
+		for (i = 0; i < 11; i++) {
+			len[i] = (i * 37) % 200;
+			rand_bytes(msgs[i], len[i]);
+			in[i] = msgs[i];
+		}
+		for (j = 16; j <= 75; j += 59) {
+			md_xmd_sh256_sim(buf, j, in, len, 11, dst, sizeof(dst));
+			for (i = 0; i < 11; i++) {
+				md_xmd_sh256(out, j, in[i], len[i], dst, sizeof(dst));
+				TEST_ASSERT(memcmp(out, buf + j * i, j) == 0, end);
+			}
+		}
+	}
+	TEST_END;
+
 	code = RLC_OK;
 
   end:
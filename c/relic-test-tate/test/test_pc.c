@@ -559,16 +559,133 @@ static int simultaneous1(void) {
 	return code;
 }
 
+#ifdef FP_COUNT
+
+/**
+ * Cost of each Miller loop step in magma/smt_cost.txt as [m, m_u, s, s_u, a,
+ * r], indexed by step. Double-precision additions count as two additions.
+ */
+static const int tate_cost[2][7][6] = {
+	{
+		{ 14, 7, 15, 2, 28, 6 },	/* SQPL */
+		{ 15, 5, 3, 0, 15, 3 },		/* SADD */
+		{ 14, 5, 4, 0, 14, 3 },		/* SSUB */
+		{ 16, 8, 10, 1, 26, 6 },	/* SDADD */
+		{ 18, 8, 10, 1, 26, 6 },	/* SDSUB */
+		{ 11, 4, 8, 1, 15, 3 },		/* SDBL */
+		{ 6, 0, 5, 0, 2, 0 }		/* SDSUBL */
+	}, {
+		{ 8, 0, 8, 0, 7, 0 },		/* SQPL_PRE */
+		{ 6, 0, 0, 0, 4, 0 },		/* SADD_PRE */
+		{ 6, 0, 0, 0, 4, 0 },		/* SSUB_PRE */
+		{ 4, 3, 4, 0, 9, 2 },		/* SDADD_PRE */
+		{ 6, 3, 4, 0, 9, 2 },		/* SDSUB_PRE */
+		{ 6, 0, 4, 0, 5, 0 },		/* SDBL_PRE */
+		{ 2, 0, 4, 0, 2, 0 }		/* SDSUBL_PRE */
+	}
+};
+
+/**
+ * Counts the prime field operations of a single Miller loop step, as the
+ * difference between running the schedules [SDBL, op] and [SDBL].
+ *
+ * @param[out] c			- the counts as [m, m_u, s, s_u, a, r, i].
+ * @param[in] op			- the step.
+ * @param[in] pre			- the flag to use the precomputed Miller loop.
+ * @param[in] q				- the auxiliary point.
+ * @param[in] p				- the point to test.
+ * @param[in] p2			- the image of the point under the endomorphism.
+ */
+static void tate_count(ull_t *c, uint8_t op, int pre, g1_t q, g1_t p, g1_t p2) {
+	ctx_t *ctx = core_get();
+	uint8_t sched[RLC_FP_BITS + 1];
+	int len = ctx->tate_len;
+	ull_t t[2][FP_OPS], n[2][FP_OPS];
+	fp_t f[4], tab[8];
+
+	for (int i = 0; i < 4; i++) {
+		fp_null(f[i]);
+		fp_new(f[i]);
+		fp_set_dig(f[i], 1);
+	}
+	for (int i = 0; i < 8; i++) {
+		fp_null(tab[i]);
+		fp_new(tab[i]);
+	}
+	memcpy(sched, ctx->tate_op, sizeof(sched));
+	ctx->tate_op[0] = TATE_SDBL;
+	ctx->tate_op[1] = op;
+	for (int j = 0; j < 2; j++) {
+		ctx->tate_len = j + 1;
+		if (pre) {
+			miller_tab(tab, q);
+		}
+		fp_count_get(t[0]);
+		if (pre) {
+			tate_miller_pre(tab, f[0], f[1], f[2], f[3], q, p, p2);
+		} else {
+			tate_miller(f[0], f[1], f[2], f[3], q, p, p2);
+		}
+		fp_count_get(t[1]);
+		for (int i = 0; i < FP_OPS; i++) {
+			n[j][i] = t[1][i] - t[0][i];
+		}
+	}
+	memcpy(ctx->tate_op, sched, sizeof(sched));
+	ctx->tate_len = len;
+
+	for (int i = 0; i < FP_OPS; i++) {
+		n[1][i] -= n[0][i];
+	}
+	c[0] = n[1][FP_OP_MUL];
+	c[1] = n[1][FP_OP_MULN];
+	c[2] = n[1][FP_OP_SQR];
+	c[3] = n[1][FP_OP_SQRN];
+	c[4] = n[1][FP_OP_ADD] + 2 * n[1][FP_OP_ADDD];
+	c[5] = n[1][FP_OP_RDC];
+	c[6] = n[1][FP_OP_INV];
+
+	for (int i = 0; i < 4; i++) {
+		fp_free(f[i]);
+	}
+	for (int i = 0; i < 8; i++) {
+		fp_free(tab[i]);
+	}
+}
+
+#endif /* FP_COUNT */
+
 static int validity1(void) {
 	int code = RLC_ERR;
-	g1_t a, b;
-	fp_t tab[FP_PRIME];
+	g1_t a, b, c[4];
+	fp_t t, u[4], v[4];
+	bn_t k, l, n;
+	tate_tab_t tab;
+	int res[4];
 	g1_null(a);
 	g1_null(b);
+	fp_null(t);
+	bn_null(k);
+	bn_null(l);
+	bn_null(n);
+	tate_tab_null(tab);
+	for (int i = 0; i < 4; i++) {
+		g1_null(c[i]);
+		fp_null(u[i]);
+		fp_null(v[i]);
+	}
 	RLC_TRY {
 		g1_new(a);
-		g1_tate_gen(b);
-		miller_tab(tab, b);
+		g1_new(b);
+		fp_new(t);
+		bn_new(k);
+		bn_new(l);
+		bn_new(n);
+		for (int i = 0; i < 4; i++) {
+			g1_new(c[i]);
+			fp_new(u[i]);
+			fp_new(v[i]);
+		}
 		TEST_CASE("validity test is correct") {
 			g1_set_infty(a);
 			TEST_ASSERT(!g1_is_valid(a), end);
@@ -576,22 +693,252 @@ static int validity1(void) {
 			TEST_ASSERT(g1_is_valid(a), end);
 		}
 		TEST_END;
-		TEST_CASE("validity test is correct-tate") {
-			g1_set_infty(a);
-			TEST_ASSERT(!g1_is_valid_tate(a,b), end);
-			g1_rand(a);
-			TEST_ASSERT(g1_is_valid_tate(a, b), end);
+
+		TEST_CASE("validating deserialization is correct") {
+			uint8_t bin[4][2 * RLC_FP_BYTES + 1];
+			const uint8_t *in[4];
+			size_t len[4];
+			for (int i = 0; i < 4; i++) {
+				g1_rand(a);
+				g1_norm(c[i], a);
+				len[i] = g1_size_bin(c[i], i & 1);
+				g1_write_bin(bin[i], len[i], c[i], i & 1);
+				in[i] = bin[i];
+				TEST_ASSERT(g1_read_bin_valid(a, bin[i], len[i]), end);
+				TEST_ASSERT(g1_cmp(a, c[i]) == RLC_EQ, end);
+			}
+			TEST_ASSERT(g1_read_bin_valid_sim(c, res, in, len, 4), end);
+			for (int i = 0; i < 4; i++) {
+				g1_read_bin(a, bin[i], len[i]);
+				TEST_ASSERT(res[i] && g1_cmp(a, c[i]) == RLC_EQ, end);
+			}
+			/* A curve point outside G_1, if there is one. */
+			ep_curve_get_cof(k);
+			do {
+				fp_rand(b->x);
+				fp_set_dig(b->z, 1);
+				b->coord = BASIC;
+				ep_rhs(t, b);
+			} while (!fp_srt(b->y, t));
+			len[0] = g1_size_bin(b, 1);
+			g1_write_bin(bin[0], len[0], b, 1);
+			TEST_ASSERT(g1_read_bin_valid(a, bin[0], len[0]) ==
+					(bn_cmp_dig(k, 1) == RLC_EQ), end);
+			/* A compressed x coordinate that is not on the curve. */
+			do {
+				fp_rand(b->x);
+				ep_rhs(t, b);
+			} while (fp_srt(b->y, t));
+			bin[1][0] = 2;
+			fp_write_bin(bin[1] + 1, RLC_FP_BYTES, b->x);
+			len[1] = RLC_FP_BYTES + 1;
+			TEST_ASSERT(!g1_read_bin_valid(a, bin[1], len[1]), end);
+			TEST_ASSERT(g1_is_infty(a), end);
+			/* An uncompressed point with a wrong y coordinate. */
+			bin[2][2 * RLC_FP_BYTES] ^= 1;
+			/* A malformed encoding and the point at infinity. */
+			bin[3][0] = 5;
+			TEST_ASSERT(!g1_read_bin_valid(a, bin[2], len[2]), end);
+			TEST_ASSERT(!g1_read_bin_valid(a, bin[3], len[3]), end);
+			TEST_ASSERT(!g1_read_bin_valid_sim(c, res, in, len, 4), end);
+			TEST_ASSERT(res[0] == (bn_cmp_dig(k, 1) == RLC_EQ), end);
+			TEST_ASSERT(!res[1] && !res[2] && !res[3], end);
+			TEST_ASSERT(g1_is_infty(c[1]) && g1_is_infty(c[3]), end);
+			bin[0][0] = 0;
+			len[0] = 1;
+			TEST_ASSERT(!g1_read_bin_valid(a, bin[0], len[0]), end);
 		}
 		TEST_END;
 
-		TEST_CASE("validity test is correct-tate_pre") {
-			g1_set_infty(a);
-			TEST_ASSERT(!g1_is_valid_tate_pre(a,b, tab), end);
-			g1_rand(a);
-			TEST_ASSERT(g1_is_valid_tate_pre(a, b, tab), end);
+		/* The Tate test is not supported when the exponent of the cofactor
+		 * part does not divide p - 1. */
+		if (tate_ord(n)) {
+			TEST_CASE("auxiliary point search is correct") {
+				TEST_ASSERT(g1_tate_find(a), end);
+				if (bn_cmp_dig(n, 1) == RLC_EQ) {
+					TEST_ASSERT(g1_is_infty(a), end);
+				} else {
+					ep_mul_basic(c[0], a, n);
+					TEST_ASSERT(g1_is_infty(c[0]), end);
+					g1_rand(c[0]);
+					TEST_ASSERT(g1_is_valid_tate(c[0], a), end);
+					/* Add a point of order 3 outside G_1 to an element of G_1. */
+					pc_get_ord(k);
+					bn_div_dig(l, n, 3);
+					bn_mul(k, k, l);
+					do {
+						fp_rand(c[1]->x);
+						fp_set_dig(c[1]->z, 1);
+						c[1]->coord = BASIC;
+						ep_rhs(t, c[1]);
+						if (fp_srt(c[1]->y, t)) {
+							ep_mul_basic(c[1], c[1], k);
+						} else {
+							g1_set_infty(c[1]);
+						}
+					} while (g1_is_infty(c[1]));
+					g1_add(c[1], c[0], c[1]);
+					g1_norm(c[1], c[1]);
+					TEST_ASSERT(!g1_is_valid_tate(c[1], a), end);
+				}
+			}
+			TEST_END;
+
+			g1_tate_gen(b);
+			if (!g1_is_infty(b)) {
+				tate_tab_make(tab, b);
+			}
+			TEST_CASE("validity test is correct-tate") {
+				g1_set_infty(a);
+				TEST_ASSERT(!g1_is_valid_tate(a,b), end);
+				g1_rand(a);
+				TEST_ASSERT(g1_is_valid_tate(a, b), end);
+			}
+			TEST_END;
+
+			TEST_CASE("validity test is correct-tate_pre") {
+				g1_set_infty(a);
+				TEST_ASSERT(!g1_is_valid_tate_pre(a,b, tab->tab), end);
+				g1_rand(a);
+				TEST_ASSERT(g1_is_valid_tate_pre(a, b, tab->tab), end);
+			}
+			TEST_END;
+
+			/* The remaining tests need the Miller table of an auxiliary point. */
+			if (!g1_is_infty(b)) {
+				TEST_CASE("miller loop schedule is correct") {
+					uint8_t op[RLC_FP_BITS + 1];
+					int len = tate_sched(op);
+					TEST_ASSERT(len > 0, end);
+					/* Evaluating the schedule must give back the loop parameter. */
+					bn_set_dig(k, 1);
+					for (int i = 0; i < len; i++) {
+						switch (op[i]) {
+							case TATE_SQPL:
+								bn_lsh(k, k, 2);
+								break;
+							case TATE_SADD:
+								bn_add_dig(k, k, 1);
+								break;
+							case TATE_SSUB:
+								bn_sub_dig(k, k, 1);
+								break;
+							case TATE_SDADD:
+								bn_dbl(k, k);
+								bn_add_dig(k, k, 1);
+								break;
+							case TATE_SDSUB:
+							case TATE_SDSUBL:
+								bn_dbl(k, k);
+								bn_sub_dig(k, k, 1);
+								break;
+							case TATE_SDBL:
+								bn_dbl(k, k);
+								break;
+						}
+					}
+					fp_prime_get_par(n);
+					if (ep_curve_is_pairf() == EP_BW13 ||
+							ep_curve_is_pairf() == EP_BW19) {
+						bn_sqr(l, n);
+						bn_sub(n, l, n);
+					} else {
+						bn_sub_dig(n, n, 1);
+						bn_abs(n, n);
+						bn_sub_dig(n, n, 1);
+					}
+					TEST_ASSERT(bn_cmp(k, n) == RLC_EQ, end);
+				}
+				TEST_END;
+
+#ifdef FP_COUNT
+				TEST_CASE("miller loop operation counts match the cost model") {
+					ull_t cnt[7];
+					g1_rand(a);
+					g1_norm(a, a);
+					ep_psi(c[0], a);
+					for (int pre = 0; pre < 2; pre++) {
+						for (uint8_t op = TATE_SQPL; op <= TATE_SDSUBL; op++) {
+							tate_count(cnt, op, pre, b, a, c[0]);
+							for (int i = 0; i < 6; i++) {
+								TEST_ASSERT(cnt[i] == (ull_t)tate_cost[pre][op][i], end);
+							}
+							TEST_ASSERT(cnt[6] == 0, end);
+						}
+					}
+				}
+				TEST_END;
+#endif
+
+				TEST_CASE("vectorized miller loop is correct") {
+					g1_rand(a);
+					g1_norm(a, a);
+					ep_psi(c[0], a);
+					for (int i = 0; i < 4; i++) {
+						fp_rand(u[i]);
+						fp_copy(v[i], u[i]);
+					}
+					tate_miller_pre(tab->tab, u[0], u[1], u[2], u[3], b, a, c[0]);
+					tate_miller_vec(tab->tab, v[0], v[1], v[2], v[3], b, a, c[0]);
+					for (int i = 0; i < 4; i++) {
+						TEST_ASSERT(fp_cmp(u[i], v[i]) == RLC_EQ, end);
+					}
+				}
+				TEST_END;
+
+				TEST_CASE("validity test is correct-tate_ctx") {
+					TEST_ASSERT(tab->len == tate_tab_len(), end);
+					TEST_ASSERT(g1_tate_get_tab() != NULL, end);
+					TEST_ASSERT(g1_tate_get_tab()->len == tab->len, end);
+					g1_tate_get(a);
+					TEST_ASSERT(g1_cmp(a, b) == RLC_EQ, end);
+					for (int i = 0; i < tab->len; i++) {
+						TEST_ASSERT(fp_cmp(g1_tate_get_tab()->tab[i], tab->tab[i]) ==
+							RLC_EQ, end);
+					}
+					g1_set_infty(a);
+					TEST_ASSERT(!g1_is_valid_tate_ctx(a), end);
+					g1_rand(a);
+					TEST_ASSERT(g1_is_valid_tate_ctx(a), end);
+				}
+				TEST_END;
+
+				TEST_CASE("validity test is correct-tate_batch") {
+					for (int i = 0; i < 4; i++) {
+						g1_rand(c[i]);
+					}
+					TEST_ASSERT(g1_is_valid_tate_batch(res, c, 4, b), end);
+					TEST_ASSERT(res[0] && res[1] && res[2] && res[3], end);
+					/* Replace one element by a curve point outside G_1. */
+					do {
+						fp_rand(c[2]->x);
+						fp_set_dig(c[2]->z, 1);
+						c[2]->coord = BASIC;
+						ep_rhs(t, c[2]);
+					} while (!fp_srt(c[2]->y, t));
+					TEST_ASSERT(!g1_is_valid_tate(c[2], b), end);
+					TEST_ASSERT(!g1_is_valid(c[2]), end);
+					TEST_ASSERT(!g1_is_valid_tate_batch(res, c, 4, b), end);
+					TEST_ASSERT(res[0] && res[1] && !res[2] && res[3], end);
+					g1_set_infty(c[0]);
+					TEST_ASSERT(!g1_is_valid_tate_batch(res, c, 4, b), end);
+					TEST_ASSERT(!res[0] && res[1] && !res[2] && res[3], end);
+				}
+				TEST_END;
+
+				TEST_CASE("validity test is correct-tate_lot") {
+					for (int i = 0; i < 4; i++) {
+						g1_rand(c[i]);
+					}
+					TEST_ASSERT(g1_is_valid_tate_lot(res, c, 4, 0), end);
+					g1_set_infty(c[1]);
+					TEST_ASSERT(!g1_is_valid_tate_lot(res, c, 4, 0), end);
+					TEST_ASSERT(res[0] && !res[1] && res[2] && res[3], end);
+				}
+				TEST_END;
+			}
 		}
-		TEST_END;
-		
+
 		TEST_CASE("blinding is consistent") {
 			g1_rand(a);
 			g1_blind(a, a);
@@ -605,6 +952,16 @@ static int validity1(void) {
   end:
 	g1_free(a);
 	g1_free(b);
+	fp_free(t);
+	bn_free(k);
+	bn_free(l);
+	bn_free(n);
+	tate_tab_free(tab);
+	for (int i = 0; i < 4; i++) {
+		g1_free(c[i]);
+		fp_free(u[i]);
+		fp_free(v[i]);
+	}
 	return code;
 }
 
@@ -641,6 +998,81 @@ static int hashing1(void) {
 	return code;
 }
 
+static int snapshot1(void) {
+	int code = RLC_ERR;
+	ctx_t *ctx = core_get(), *cpy = NULL;
+	size_t len = core_size_bin();
+	uint8_t *bin = NULL;
+	g1_t a, b, c;
+	bn_t k, n;
+
+	g1_null(a);
+	g1_null(b);
+	g1_null(c);
+	bn_null(k);
+	bn_null(n);
+
+	RLC_TRY {
+		g1_new(a);
+		g1_new(b);
+		g1_new(c);
+		bn_new(k);
+		bn_new(n);
+
+		pc_get_ord(n);
+
+		/* Snapshots are only supported with automatic allocation. */
+		if (len > 0) {
+			TEST_CASE("parameter snapshots are correct") {
+				bin = (uint8_t *)malloc(len);
+				cpy = (ctx_t *)calloc(1, sizeof(ctx_t));
+				TEST_ASSERT(bin != NULL && cpy != NULL, end);
+				core_write_bin(bin, len);
+				g1_rand(a);
+				bn_rand_mod(k, n);
+				g1_mul(b, a, k);
+				/* Load the snapshot in a fresh context. */
+				core_set(cpy);
+				core_init();
+				TEST_ASSERT(core_read_bin(bin, len) == RLC_OK, end);
+				TEST_ASSERT(g1_is_valid(a), end);
+				g1_mul(c, a, k);
+				TEST_ASSERT(g1_cmp(b, c) == RLC_EQ, end);
+				g1_mul_gen(c, k);
+				core_clean();
+				core_set(ctx);
+				g1_mul_gen(b, k);
+				TEST_ASSERT(g1_cmp(b, c) == RLC_EQ, end);
+				/* Corrupted or truncated snapshots must be rejected. */
+				TEST_ASSERT(core_read_bin(bin, len - 1) == RLC_ERR, end);
+				bin[len / 2] ^= 1;
+				TEST_ASSERT(core_read_bin(bin, len) == RLC_ERR, end);
+				bin[len / 2] ^= 1;
+				TEST_ASSERT(core_read_bin(bin, len) == RLC_OK, end);
+				TEST_ASSERT(g1_is_valid(a), end);
+			}
+			TEST_END;
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_ERROR(end);
+	}
+	code = RLC_OK;
+  end:
+	if (core_get() == cpy) {
+		core_clean();
+		core_set(ctx);
+	}
+	free(cpy);
+	free(bin);
+	g1_free(a);
+	g1_free(b);
+	g1_free(c);
+	bn_free(k);
+	bn_free(n);
+	return code;
+}
+
 static int memory2(void) {
 	err_t e = ERR_CAUGHT;
 	int code = RLC_ERR;
@@ -1717,6 +2149,10 @@ int test1(void) {
 		return RLC_ERR;
 	}
 
+	if (snapshot1() != RLC_OK) {
+		return RLC_ERR;
+	}
+
 	return RLC_OK;
 }
 
@@ -0,0 +1,290 @@
+#!/usr/bin/env python3
+#
+# RELIC is an Efficient LIbrary for Cryptography
+# Copyright (c) 2023 RELIC Authors
+#
+# This file is part of RELIC. RELIC is legal property of its developers,
+# whose names are not listed here. Please refer to the COPYRIGHT file
+# for contact information.
+#
+# RELIC is free software; you can redistribute it and/or modify it under the
+# terms of the version 2.1 (or later) of the GNU Lesser General Public License
+# as published by the Free Software Foundation; or version 2.0 of the Apache
+# License as published by the Apache Software Foundation. See the LICENSE files
+# for more details.
+#
+# RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+# WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+# A PARTICULAR PURPOSE. See the LICENSE files for more details.
+#
+# You should have received a copy of the GNU Lesser General Public or the
+# Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+# or <https://www.apache.org/licenses/>.
+#
+# Generates src/fp/relic_fp_exp_z.c, the straight-line addition chains that
+# raise a prime field element to the absolute value of the curve parameter.
+#
+# Usage: tools/relic-gen-expz.py > src/fp/relic_fp_exp_z.c
+#
+# Inversions are expensive in F_p, so chains only use squarings and
+# multiplications by small odd powers. For each parameter, the generator
+# tries every sliding window width and keeps the cheapest chain under the
+# cost model below.
+
+import sys
+
+# Relative cost of a squaring against a multiplication, from bench_fp on x64.
+SQR = 0.87
+
+# Parameters of the pairing-friendly curves, as set in relic_fp_param.c.
+SEEDS = [
+	("BW19_286", 286, -145),
+	("BW13_310", 310, -(2**11 + 2**7 + 2**5 + 2**4)),
+	("B24_315", 315, -2**32 + 2**30 + 2**21 + 2**20 + 1),
+	("B24_317", 317, 2**31 + 2**30 + 2**28 + 2**27 + 2**24 + 2**16 + 2**15),
+	("B12_377", 377, 2**63 + 2**58 + 2**56 + 2**51 + 2**47 + 2**46 + 1),
+	("B12_381", 381, -(2**63 + 2**62 + 2**60 + 2**57 + 2**48 + 2**16)),
+	("B12_383", 383, 2**64 + 2**51 + 2**24 + 2**12 + 2**9),
+	("B12_446", 446, -(2**75 - 2**73 + 2**63 + 2**57 + 2**50 + 2**17 + 1)),
+	("B12_455", 455, 2**76 + 2**53 + 2**31 + 2**11),
+	("B24_509", 509, -2**51 - 2**28 + 2**11 - 1),
+	("B48_575", 575, 2**32 - 2**18 - 2**10 - 2**4),
+	("B12_638", 638, -(2**107 - 2**105 - 2**93 - 2**5)),
+]
+
+def precomp(digs):
+	"""Finds a shortest star addition chain from 1 covering all digits."""
+	need = sorted(set(digs) - {1})
+	if not need:
+		return 0, []
+	top = need[-1]
+	if len(need) > 6:
+		# Too many digits for an exhaustive search, take all odd powers.
+		steps = [(2, 1, 1)] + [(v, v - 2, 2) for v in range(3, top + 1, 2)]
+		return SQR + len(steps) - 1, steps
+	best = [None]
+
+	def search(ch, steps, left):
+		if left == 0:
+			if any(v not in ch for v in need):
+				return
+			cost = sum(SQR if a == b else 1 for _, a, b in steps)
+			if best[0] is None or cost < best[0][0]:
+				best[0] = (cost, list(steps))
+			return
+		if len(need) - sum(1 for v in need if v in ch) > left:
+			return
+		if ch[-1] << left < top:
+			return
+		# Star chains: every step adds some element to the last one.
+		for j in range(len(ch) - 1, -1, -1):
+			v = ch[-1] + ch[j]
+			if v > top:
+				continue
+			steps.append((v, ch[-1], ch[j]))
+			search(ch + [v], steps, left - 1)
+			steps.pop()
+
+	for n in range(1, 2 * top.bit_length() + len(need)):
+		search([1], [], n)
+		if best[0] is not None:
+			return best[0]
+
+def windows(e, digs, first):
+	"""Splits e into windows from the allowed digits at minimum cost. Returns
+	the cost, the (squarings, digit) pairs and the trailing squarings. The
+	leading window may also be any value in first, at the given extra cost."""
+	bits = bin(e)[2:]
+	n = len(bits)
+	# f[i] is the cheapest way to have processed the first i bits.
+	f = [None] * (n + 1)
+	for j in range(1, n + 1):
+		v = int(bits[:j], 2)
+		if bits[j - 1] == '1' and v in digs:
+			f[j] = (0, [(0, v)], 0)
+		elif v in first:
+			f[j] = (first[v], [(0, v)], 0)
+	for i in range(1, n):
+		if f[i] is None:
+			continue
+		cost, path, zero = f[i]
+		cand = []
+		if bits[i] == '0':
+			cand.append((i + 1, (cost + SQR, path, zero + 1)))
+		else:
+			for j in range(i + 1, n + 1):
+				if bits[j - 1] == '1' and int(bits[i:j], 2) in digs:
+					cand.append((j, (cost + SQR * (j - i) + 1,
+						path + [(zero + j - i, int(bits[i:j], 2))], 0)))
+		for j, c in cand:
+			if f[j] is None or c[0] < f[j][0]:
+				f[j] = c
+	return f[n]
+
+def chain(e, w):
+	"""Builds the cheapest chain for e with digits below 2^w."""
+	digs, first = set(range(1, 1 << w, 2)), {}
+	for _ in range(4):
+		cost, path, tail = windows(e, digs, first)
+		used = set(d for _, d in path)
+		pre, steps = precomp(used)
+		if used == digs:
+			break
+		digs = used
+		# Let the leading window start from a power one step away.
+		ch = [1] + [v for v, _, _ in steps]
+		first = {a + b: SQR if a == b else 1 for a in ch for b in ch}
+		first.update({v: 0 for v in ch})
+	return cost + pre, steps, path, tail
+
+def best(e):
+	return min((chain(e, w) for w in range(1, 7)), key=lambda c: c[0])
+
+def sqrs(n, out):
+	if n == 1:
+		out.append("\t\t\t\tfp_sqr(r, r);")
+	elif n > 1:
+		out.append("\t\t\t\tfor (i = 0; i < %d; i++) {" % n)
+		out.append("\t\t\t\t\tfp_sqr(r, r);")
+		out.append("\t\t\t\t}")
+
+def emit(name, z):
+	e = abs(z)
+	cost, steps, digs, sqr = best(e)
+	slot = {1: 0}
+	for v, _, _ in steps:
+		slot[v] = len(slot)
+	nsqr = sum(1 for _, a, b in steps if a == b) + sum(s for s, _ in digs[1:])
+	nsqr += sqr
+	nmul = len(steps) - sum(1 for _, a, b in steps if a == b) + len(digs) - 1
+	out = ["\t\t\t\tfp_copy(t[0], a);"]
+	for v, a, b in steps:
+		if a == b:
+			out.append("\t\t\t\tfp_sqr(t[%d], t[%d]);" % (slot[v], slot[a]))
+		else:
+			out.append("\t\t\t\tfp_mul(t[%d], t[%d], t[%d]);" %
+				(slot[v], slot[a], slot[b]))
+	v = digs[0][1]
+	if v in slot:
+		out.append("\t\t\t\tfp_copy(r, t[%d]);" % slot[v])
+	else:
+		a = max(a for a in slot if v - a in slot)
+		out.append("\t\t\t\tfp_mul(r, t[%d], t[%d]);" % (slot[a], slot[v - a]))
+		nmul += 1
+	for s, d in digs[1:]:
+		sqrs(s, out)
+		out.append("\t\t\t\tfp_mul(r, r, t[%d]);" % slot[d])
+	sqrs(sqr, out)
+	out.append("\t\t\t\tbreak;")
+	out = ["\t\t\tcase %s:" % name,
+		"\t\t\t\t/* |x| = 0x%X, %d squarings and %d multiplications. */" %
+		(e, nsqr, nmul)] + out
+	return out, len(slot)
+
+def main():
+	body, size = [], []
+	for name, prime, z in SEEDS:
+		out, n = emit(name, z)
+		size.append("#%s FP_PRIME == %d\n#define EXPZ_TAB\t\t%d" %
+			("elif" if size else "if", prime, n))
+		body.append("#if FP_PRIME == %d" % prime)
+		body.extend(out)
+		body.append("#endif")
+	size.append("#else\n#define EXPZ_TAB\t\t1\n#endif")
+
+	print(PREAMBLE % "\n".join(size), end="")
+	print("\n".join(body))
+	print(POSTAMBLE, end="")
+
+PREAMBLE = """/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2023 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the exponentiation by the curve parameter in the prime
+ * field. Generated by tools/relic-gen-expz.py, do not edit.
+ *
+ * @ingroup fp
+ */
+
+#include "relic_core.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Number of precomputed powers used by the addition chain.
+ */
+%s
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+void fp_exp_z(fp_t c, const fp_t a) {
+	fp_t r, t[EXPZ_TAB];
+	bn_t n;
+	int i;
+
+	bn_null(n);
+	fp_null(r);
+	for (i = 0; i < EXPZ_TAB; i++) {
+		fp_null(t[i]);
+	}
+
+	RLC_TRY {
+		bn_new(n);
+		fp_new(r);
+		for (i = 0; i < EXPZ_TAB; i++) {
+			fp_new(t[i]);
+		}
+
+		switch (fp_param_get()) {
+"""
+
+POSTAMBLE = """			default:
+				(void)t;
+				fp_prime_get_par(n);
+				bn_abs(n, n);
+				fp_exp(r, a, n);
+				break;
+		}
+		fp_copy(c, r);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(n);
+		fp_free(r);
+		for (i = 0; i < EXPZ_TAB; i++) {
+			fp_free(t[i]);
+		}
+	}
+}
+"""
+
+if __name__ == "__main__":
+	main()
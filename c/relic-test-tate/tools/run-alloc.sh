@@ -0,0 +1,68 @@
+set -e
+
+# Builds bench_smt once for each memory-allocation policy and prints one table
+# comparing the latencies measured under ALLOC=AUTO, DYNAMIC and ARENA. The
+# preset can be given as an argument, and METRIC selects the column reported
+# by bench_smt (mean, p50, p90, p99 or max). Each benchmark takes BENCH^2
+# samples, so BENCH defaults to a smaller value than in regular builds.
+
+preset=${1:-x64-pbc-bls12-381}
+policies="AUTO DYNAMIC ARENA"
+metric=${METRIC:-p50}
+bench=${BENCH:-32}
+
+for alloc in $policies; do
+ echo target-$preset-$alloc
+ mkdir -p target-$preset-$alloc
+ cd target-$preset-$alloc
+ sh ../preset/$preset.sh ../ > /dev/null
+ cmake -DBENCH=$bench -DALLOC=$alloc . > /dev/null
+ make bench_smt > build.log 2>&1
+ ./bin/bench_smt --csv ../alloc-$alloc.csv > ../alloc-$alloc.log
+ cd ..
+done
+
+# Rows are benchmark labels, columns are allocation policies.
+for alloc in $policies; do
+ echo alloc-$alloc.csv
+done | xargs awk -F, -v metric=$metric '
+FNR == 1 {
+ name = FILENAME
+ sub(/^alloc-/, "", name)
+ sub(/\.csv$/, "", name)
+ cols[++ncols] = name
+ for (i = 1; i <= NF; i++) {
+  if ($i == metric) {
+   col = i
+  }
+ }
+ next
+}
+{
+ gsub(/"/, "", $1)
+ if (!($1 in seen)) {
+  seen[$1] = 1
+  rows[++nrows] = $1
+ }
+ cell[$1, name] = $col
+ unit = $2
+}
+END {
+ printf "| %-24s |", metric " (" unit ")"
+ for (j = 1; j <= ncols; j++) {
+  printf " %12s |", cols[j]
+ }
+ printf "\n|%s|", "--------------------------"
+ for (j = 1; j <= ncols; j++) {
+  printf "%s|", "--------------"
+ }
+ printf "\n"
+ for (i = 1; i <= nrows; i++) {
+  printf "| %-24s |", rows[i]
+  for (j = 1; j <= ncols; j++) {
+   v = cell[rows[i], cols[j]]
+   printf " %12s |", (v == "" ? "-" : v)
+  }
+  printf "\n"
+ }
+}' | tee alloc-table.md
@@ -0,0 +1,71 @@
+set -e
+
+# Builds bench_smt for each pairing-friendly preset and prints one table
+# comparing subgroup membership testing and cofactor clearing across curves.
+# Presets can be given as arguments, and METRIC selects the column reported
+# by bench_smt (mean, p50, p90, p99 or max). Each benchmark takes BENCH^2
+# samples, so BENCH defaults to a smaller value than in regular builds.
+
+presets="$@"
+if [ -z "$presets" ]; then
+ presets="x64-pbc-bls12-381 x64-pbc-bls12-446 x64-pbc-bls24-315
+  x64-pbc-bls24-509 x64-pbc-bls48-575 x64-pbc-bw310 x64-pbc-bw286"
+fi
+metric=${METRIC:-p50}
+bench=${BENCH:-32}
+
+for file in $presets; do
+ echo target-$file
+ mkdir -p target-$file
+ cd target-$file
+ sh ../preset/$file.sh ../ > /dev/null
+ cmake -DBENCH=$bench . > /dev/null
+ make bench_smt > build.log 2>&1
+ ./bin/bench_smt --csv ../smt-$file.csv > ../smt-$file.log
+ cd ..
+done
+
+# Rows are benchmark labels, columns are presets.
+for file in $presets; do
+ echo smt-$file.csv
+done | xargs awk -F, -v metric=$metric '
+FNR == 1 {
+ name = FILENAME
+ sub(/^smt-x64-pbc-/, "", name)
+ sub(/\.csv$/, "", name)
+ cols[++ncols] = name
+ for (i = 1; i <= NF; i++) {
+  if ($i == metric) {
+   col = i
+  }
+ }
+ next
+}
+{
+ gsub(/"/, "", $1)
+ if (!($1 in seen)) {
+  seen[$1] = 1
+  rows[++nrows] = $1
+ }
+ cell[$1, name] = $col
+ unit = $2
+}
+END {
+ printf "| %-24s |", metric " (" unit ")"
+ for (j = 1; j <= ncols; j++) {
+  printf " %12s |", cols[j]
+ }
+ printf "\n|%s|", "--------------------------"
+ for (j = 1; j <= ncols; j++) {
+  printf "%s|", "--------------"
+ }
+ printf "\n"
+ for (i = 1; i <= nrows; i++) {
+  printf "| %-24s |", rows[i]
+  for (j = 1; j <= ncols; j++) {
+   v = cell[rows[i], cols[j]]
+   printf " %12s |", (v == "" ? "-" : v)
+  }
+  printf "\n"
+ }
+}' | tee smt-table.md